@@ -0,0 +1,21 @@
+# Writes GitSha.h with the current commit; run on every build, but the
+# header is only rewritten (and BenchmarkRecord.cpp only recompiled) when
+# the commit or the dirty state changes
+execute_process(
+    COMMAND git describe --always --dirty
+    WORKING_DIRECTORY ${SOURCE_DIR}
+    OUTPUT_VARIABLE GIT_SHA
+    OUTPUT_STRIP_TRAILING_WHITESPACE
+    ERROR_QUIET
+)
+if(NOT GIT_SHA)
+    set(GIT_SHA "unknown")
+endif()
+
+set(CONTENT "#pragma once\n#define ENGINE_GIT_SHA \"${GIT_SHA}\"\n")
+if(EXISTS ${OUTPUT})
+    file(READ ${OUTPUT} EXISTING)
+endif()
+if(NOT "${EXISTING}" STREQUAL "${CONTENT}")
+    file(WRITE ${OUTPUT} "${CONTENT}")
+endif()
@@ -0,0 +1,155 @@
+# Release vs PGO (vs BOLT) build, training and side-by-side benchmark.
+#
+#   cmake -DSOURCE_DIR=<repo> -DBUILD_ROOT=<dir> [-DBOLT=ON] [-DMESSAGES=5000000]
+#         [-DREPEAT=5] [-DGENERATOR=Ninja] [-DCXX_COMPILER=clang++]
+#         [-DEXTRA_ARGS="-DENGINE_CLOCK=TSC;..."] -P cmake/PgoPipeline.cmake
+#
+# 1. <BUILD_ROOT>/release: the normal Release build, also used to write the corpora
+# 2. <BUILD_ROOT>/pgo: instrumented (ENGINE_PGO=GENERATE), trained on the
+#    amend-heavy corpus and every built-in scenario, then rebuilt in place
+#    with ENGINE_PGO=USE (GCC finds its profiles by object path)
+# 3. BOLT=ON: llvm-bolt instruments the PGO binary, replays the same training
+#    and writes <BUILD_ROOT>/LowLatencyExecutionEngine.bolt with hot/cold
+#    block and function layout
+# 4. Each binary runs `bench` over the zipf-universe corpus REPEAT times,
+#    interleaved so drift hits all of them alike, into JSON records that the
+#    engine's own `compare` mode tests against the Release runs
+
+if(NOT SOURCE_DIR OR NOT BUILD_ROOT)
+    message(FATAL_ERROR "PgoPipeline.cmake needs -DSOURCE_DIR=<repo> -DBUILD_ROOT=<dir>")
+endif()
+if(NOT MESSAGES)
+    set(MESSAGES 5000000)
+endif()
+if(NOT REPEAT)
+    set(REPEAT 5)
+endif()
+
+set(CONFIGURE_ARGS -DCMAKE_BUILD_TYPE=Release ${EXTRA_ARGS})
+if(GENERATOR)
+    list(APPEND CONFIGURE_ARGS -G ${GENERATOR})
+endif()
+if(CXX_COMPILER)
+    list(APPEND CONFIGURE_ARGS -DCMAKE_CXX_COMPILER=${CXX_COMPILER})
+endif()
+
+function(run_step description)
+    message(STATUS "[pgo] ${description}")
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "[pgo] ${description} failed (${result})")
+    endif()
+endfunction()
+
+function(build_engine dir)
+    file(MAKE_DIRECTORY ${dir})
+    message(STATUS "[pgo] configure ${dir}")
+    execute_process(COMMAND ${CMAKE_COMMAND} ${SOURCE_DIR} ${CONFIGURE_ARGS} ${ARGN} WORKING_DIRECTORY ${dir} RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "[pgo] configure ${dir} failed (${result})")
+    endif()
+    run_step("build ${dir}" ${CMAKE_COMMAND} --build ${dir} --config Release --target LowLatencyExecutionEngine)
+endfunction()
+
+function(require_program var)
+    find_program(${var} NAMES ${ARGN})
+    if(NOT ${var})
+        message(FATAL_ERROR "[pgo] none of ${ARGN} found")
+    endif()
+endfunction()
+
+function(engine_path dir out)
+    foreach(candidate ${dir}/src/LowLatencyExecutionEngine ${dir}/src/Release/LowLatencyExecutionEngine.exe)
+        if(EXISTS ${candidate})
+            set(${out} ${candidate} PARENT_SCOPE)
+            return()
+        endif()
+    endforeach()
+    message(FATAL_ERROR "[pgo] no engine binary under ${dir}")
+endfunction()
+
+# Every way the training exercises the parse path
+function(train engine)
+    run_step("train: bench" ${engine} bench ${BUILD_ROOT}/train.corpus)
+    run_step("train: bench --sink queue" ${engine} bench ${BUILD_ROOT}/train.corpus --sink queue)
+    run_step("train: scenarios" ${engine} scenarios)
+endfunction()
+
+set(RELEASE_DIR ${BUILD_ROOT}/release)
+set(PGO_DIR ${BUILD_ROOT}/pgo)
+set(PGO_DATA ${BUILD_ROOT}/pgo-data)
+
+# --- 1. Release baseline and corpora ---
+build_engine(${RELEASE_DIR} -DENGINE_PGO=OFF -DENGINE_BOLT=OFF)
+engine_path(${RELEASE_DIR} RELEASE_ENGINE)
+run_step("write training corpus" ${RELEASE_ENGINE} corpus amend-heavy ${BUILD_ROOT}/train.corpus ${MESSAGES})
+run_step("write evaluation corpus" ${RELEASE_ENGINE} corpus zipf-universe ${BUILD_ROOT}/eval.corpus ${MESSAGES})
+
+# --- 2. Instrument, train, rebuild with the profile ---
+file(REMOVE_RECURSE ${PGO_DATA})
+file(GLOB_RECURSE STALE_GCDA ${PGO_DIR}/*.gcda)
+if(STALE_GCDA)
+    file(REMOVE ${STALE_GCDA})
+endif()
+build_engine(${PGO_DIR} -DENGINE_PGO=GENERATE -DENGINE_PGO_DATA=${PGO_DATA} -DENGINE_BOLT=${BOLT})
+engine_path(${PGO_DIR} PGO_ENGINE)
+train(${PGO_ENGINE})
+
+# Clang leaves raw profiles to merge; GCC has already written its .gcda files
+file(GLOB RAW_PROFILES ${PGO_DATA}/*.profraw)
+if(RAW_PROFILES)
+    require_program(LLVM_PROFDATA llvm-profdata llvm-profdata-19 llvm-profdata-18 llvm-profdata-17 llvm-profdata-16)
+    run_step("merge clang profiles" ${LLVM_PROFDATA} merge -output=${PGO_DATA}/engine.profdata ${RAW_PROFILES})
+endif()
+
+build_engine(${PGO_DIR} -DENGINE_PGO=USE -DENGINE_PGO_DATA=${PGO_DATA} -DENGINE_BOLT=${BOLT})
+set(ENGINE_NAMES release pgo)
+set(ENGINE_BINARIES ${RELEASE_ENGINE} ${PGO_ENGINE})
+
+# --- 3. Optional BOLT layout on top of PGO ---
+if(BOLT)
+    require_program(LLVM_BOLT llvm-bolt llvm-bolt-19 llvm-bolt-18 llvm-bolt-17)
+    require_program(MERGE_FDATA merge-fdata merge-fdata-19 merge-fdata-18 merge-fdata-17)
+    set(BOLT_DATA ${BUILD_ROOT}/bolt-data)
+    set(BOLT_ENGINE ${BUILD_ROOT}/LowLatencyExecutionEngine.bolt)
+    file(REMOVE_RECURSE ${BOLT_DATA})
+    file(MAKE_DIRECTORY ${BOLT_DATA})
+
+    run_step("bolt: instrument" ${LLVM_BOLT} ${PGO_ENGINE} -instrument -instrumentation-file=${BOLT_DATA}/engine.fdata
+             -instrumentation-file-append-pid -o ${BUILD_ROOT}/LowLatencyExecutionEngine.bolt-inst)
+    train(${BUILD_ROOT}/LowLatencyExecutionEngine.bolt-inst)
+
+    file(GLOB BOLT_PROFILES ${BOLT_DATA}/*.fdata)
+    execute_process(COMMAND ${MERGE_FDATA} ${BOLT_PROFILES} OUTPUT_FILE ${BUILD_ROOT}/bolt.fdata RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "[pgo] merge-fdata failed (${result})")
+    endif()
+    run_step("bolt: optimize" ${LLVM_BOLT} ${PGO_ENGINE} -o ${BOLT_ENGINE} -data=${BUILD_ROOT}/bolt.fdata
+             -reorder-blocks=ext-tsp -reorder-functions=hfsort -split-functions -split-all-cold -dyno-stats)
+    list(APPEND ENGINE_NAMES bolt)
+    list(APPEND ENGINE_BINARIES ${BOLT_ENGINE})
+endif()
+
+# --- 4. Side by side ---
+foreach(name release pgo bolt)
+    file(REMOVE ${BUILD_ROOT}/${name}.jsonl)
+endforeach()
+list(LENGTH ENGINE_NAMES ENGINE_COUNT)
+math(EXPR LAST_ENGINE "${ENGINE_COUNT} - 1")
+foreach(run RANGE 1 ${REPEAT})
+    foreach(i RANGE ${LAST_ENGINE})
+        list(GET ENGINE_NAMES ${i} name)
+        list(GET ENGINE_BINARIES ${i} engine)
+        run_step("bench ${name} (run ${run}/${REPEAT})" ${engine} bench ${BUILD_ROOT}/eval.corpus
+                 --record ${BUILD_ROOT}/${name}.jsonl)
+    endforeach()
+endforeach()
+
+# compare exits 2 on a regression; that is a result here, not a failure
+foreach(name pgo bolt)
+    if(EXISTS ${BUILD_ROOT}/${name}.jsonl)
+        message(STATUS "[pgo] release vs ${name}")
+        execute_process(COMMAND ${RELEASE_ENGINE} compare ${BUILD_ROOT}/release.jsonl ${BUILD_ROOT}/${name}.jsonl)
+    endif()
+endforeach()
+message(STATUS "[pgo] records: ${BUILD_ROOT}/{release,pgo,bolt}.jsonl, PGO binary: ${PGO_ENGINE}")
@@ -0,0 +1,89 @@
+#pragma once
+#include <Order.h>
+#include <TimerWheel.h>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <vector>
+
+enum struct AlgoType : uint8_t {
+    TWAP = 0,   // equal slices over [startTick, endTick]
+    VWAP = 1,   // slices weighted by a volume profile curve
+    POV = 2     // follows a share of traded volume from market data
+};
+
+struct ParentOrderSpec {
+    uint64_t parentId = 0;
+    char symbol[8]{};
+    uint32_t instrumentId = 0;
+    Side side = Side::Buy;
+    uint32_t quantity = 0;
+    double limitPrice = 0.0;
+    AlgoType algo = AlgoType::TWAP;
+    uint64_t startTick = 0;
+    uint64_t endTick = 0;
+    uint32_t slices = 1;                        // TWAP / VWAP
+    const std::vector<double>* profile = nullptr; // VWAP: one weight per slice, shared and caller-owned
+    double participation = 0.0;                 // POV: fraction of traded volume
+    uint32_t minClip = 1;                       // POV: smallest child worth sending
+};
+
+// Works parent orders by slicing them into child Orders. Slice times are held
+// in a TimerWheel (one intrusive node per algo) and POV algos hang off a per-instrument list, so
+// each tick or market data update only touches the algos that are due.
+// Children take ids from the calling thread's OrderIdGenerator and are handed
+// to `sink`, which feeds the regular serialize/send path.
+class AlgoScheduler {
+public:
+    using ChildSink = std::function<void(const Order&)>;
+    using Handle = uint32_t;
+
+    // The wheel starts at nowTick's slot, so clock-scale ticks don't all land on its overflow list
+    AlgoScheduler(size_t maxAlgos, size_t maxInstruments, uint64_t ticksPerSlot, uint64_t nowTick, ChildSink sink);
+
+    // nullopt when full or the spec is unusable (no quantity, bad window,
+    // VWAP profile of the wrong length, negative weights or zero total)
+    std::optional<Handle> submit(const ParentOrderSpec& spec);
+    void cancel(Handle handle);
+
+    // Drive with the current tick; fires every slice due since the last call
+    void onTimer(uint64_t nowTick);
+    void onMarketData(uint32_t instrumentId, uint64_t tradedVolume, uint64_t nowTick);
+
+    [[nodiscard]] bool active(Handle handle) const;
+    [[nodiscard]] uint32_t sent(Handle handle) const;
+    [[nodiscard]] size_t activeCount() const;
+
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    struct AlgoState {
+        ParentOrderSpec spec;
+        uint32_t sent = 0;
+        uint32_t nextSlice = 0;
+        double profileTotal = 0.0;
+        double profileDone = 0.0;
+        uint64_t marketVolume = 0;
+        TimerNode timer;
+        uint32_t mdNext = NONE, mdPrev = NONE;
+        bool active = false;
+    };
+
+    void schedule(uint32_t index, uint64_t dueTick);
+    void unschedule(uint32_t index);
+    void linkInstrument(uint32_t index);
+    void unlinkInstrument(uint32_t index);
+    void fire(uint32_t index, uint64_t nowTick);
+    void emit(AlgoState& algo, uint32_t quantity, uint64_t nowTick);
+    void finish(uint32_t index);
+    uint64_t sliceTick(const AlgoState& algo, uint32_t slice) const;
+
+    std::vector<AlgoState> algos_;
+    std::vector<uint32_t> freeList_;
+    std::vector<uint32_t> instrumentHead_;  // instrument -> first POV algo
+    uint64_t ticksPerSlot_;
+    size_t activeCount_ = 0;
+    ChildSink sink_;
+    TimerWheel wheel_;                      // ticks are slots of ticksPerSlot
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <BatchFrame.h>
+#include <MessageParser.h>
+#include <Order.h>
+#include <optional>
+#include <vector>
+
+// Packs serialized orders into a single batch frame (sender side)
+class BatchEncoder {
+public:
+    explicit BatchEncoder(const batch::LinkConfig& link = {});
+
+    // Returns false when the frame has no room for another message
+    bool add(const Order& order);
+
+    // Writes the header and returns the finished frame; valid until the next reset()
+    const uint8_t* finish(uint64_t sequence, uint64_t sendTimestampNs, size_t& length);
+    void reset();
+
+    [[nodiscard]] size_t count() const;
+    [[nodiscard]] size_t capacity() const;
+    [[nodiscard]] bool full() const;
+    [[nodiscard]] bool empty() const;
+
+private:
+    MessageParser parser_;
+    std::vector<uint8_t> buffer_;
+    batch::LinkConfig link_;
+    size_t stride_;
+    size_t capacity_;
+    size_t count_;
+};
+
+// Validates a batch frame and hands its body to MessageParser::parseBatch (receiver side)
+class BatchDecoder {
+public:
+    // Returns the number of valid orders written to `out`, or nullopt if the frame is malformed
+    std::optional<size_t> decode(const uint8_t* data, size_t size, Order* out, size_t maxOut);
+
+    // Header of the last well-formed frame, in host byte order
+    [[nodiscard]] const BatchHeader& lastHeader() const;
+    [[nodiscard]] uint64_t sequenceGaps() const;
+    [[nodiscard]] uint64_t crcFailures() const;
+
+private:
+    MessageParser parser_;
+    BatchHeader last_{};
+    uint64_t expectedSequence_ = 0;
+    uint64_t sequenceGaps_ = 0;
+    uint64_t crcFailures_ = 0;
+};
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <WireOrder.h>
+
+// Multi-message frame: one BatchHeader followed by `count` messages in the
+// link's wire format, `stride` bytes apart. All fields big-endian.
+#pragma pack(push, 1)
+struct BatchHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t total_length;      // header + body, in bytes
+    uint16_t stride;            // message size (+ CRC trailer), rounded up when padded
+    uint8_t flags;
+    uint8_t format;             // WireFormat
+    uint64_t sequence;
+    uint64_t send_timestamp_ns;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(BatchHeader) == 32, "BatchHeader must be exactly 32 bytes");
+
+namespace batch {
+
+constexpr uint32_t MAGIC = 0x4C4C4542; // "LLEB"
+constexpr uint16_t VERSION = 1;
+
+// Largest UDP payload that fits a 1500-byte Ethernet MTU without fragmenting
+constexpr size_t MAX_DATAGRAM_BYTES = 1472;
+
+// Header flags
+constexpr uint8_t FLAG_CRC_PER_MESSAGE = 0x01; // 4-byte CRC32C after each WireOrder
+constexpr uint8_t FLAG_CRC_PER_BATCH   = 0x02; // 4-byte CRC32C over header + body, after the body
+
+constexpr size_t CRC_BYTES = sizeof(uint32_t);
+
+enum struct CrcMode : uint8_t {
+    None = 0,
+    PerMessage = 1,
+    PerBatch = 2
+};
+
+constexpr size_t messageSize(WireFormat format) {
+    return format == WireFormat::Aligned ? sizeof(AlignedWireOrder) : sizeof(WireOrder);
+}
+
+// Per-link framing options
+struct LinkConfig {
+    WireFormat format = WireFormat::Packed;
+    bool padded = false;                    // implied by WireFormat::Aligned
+    CrcMode crc = CrcMode::None;
+    size_t maxFrameBytes = MAX_DATAGRAM_BYTES;
+};
+
+// Distance between consecutive messages; padding keeps every message 8-byte aligned
+constexpr size_t stride(const LinkConfig& link) {
+    size_t bytes = messageSize(link.format) + (link.crc == CrcMode::PerMessage ? CRC_BYTES : 0);
+    bool padded = link.padded || link.format == WireFormat::Aligned;
+    return padded ? (bytes + 7) & ~size_t(7) : bytes;
+}
+
+} // namespace batch
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+#include <BenchmarkRecord.h>
+
+struct MannWhitneyResult {
+    double u = 0.0;             // U statistic of the first sample
+    double pValue = 1.0;        // two-sided
+    bool exact = false;         // exact distribution (small, tie-free samples) or normal approximation
+};
+
+struct ConfidenceInterval {
+    double low = 0.0;
+    double high = 0.0;
+};
+
+struct CompareOptions {
+    double alpha = 0.05;        // significance level for the rank test and the CI
+    double threshold = 0.02;    // smallest relative change worth flagging
+    size_t resamples = 2000;    // bootstrap iterations
+    uint64_t seed = 1;
+};
+
+// Decides whether a candidate set of benchmark records differs from a
+// baseline set by more than run-to-run noise. When the run counts can reach
+// alpha (2 / C(m+n, m) <= alpha, so 4 per side at 0.05), each run is one
+// observation; fewer runs fall back to the latency samples they carry,
+// where only the latency rows can be tested.
+class BenchmarkCompare {
+public:
+    static MannWhitneyResult mannWhitney(const std::vector<double>& a, const std::vector<double>& b);
+
+    // Percentile bootstrap interval for (q(b) - q(a)) / q(a), q the given quantile
+    static ConfidenceInterval bootstrapRelativeChange(const std::vector<double>& a, const std::vector<double>& b,
+                                                      double quantile, double confidence, size_t resamples, uint64_t seed);
+
+    // Prints one table per benchmark name present on both sides and returns
+    // the number of regressions flagged
+    static size_t compare(const std::vector<BenchmarkRecord>& baseline, const std::vector<BenchmarkRecord>& candidate,
+                          const CompareOptions& options, std::ostream& out);
+};
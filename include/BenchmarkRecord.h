@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <PerfCounters.h>
+
+// One benchmark run, stored as a line of JSON so repeated runs append to
+// the same file and a baseline file can sit next to a candidate one.
+// Metrics named *_ns (and every counter) are lower-is-better; the rest,
+// such as throughput, are higher-is-better.
+struct BenchmarkRecord {
+    std::string name;               // e.g. "bench/parse/zipf.corpus/discard"
+    std::string gitSha;
+    std::string clock;
+    uint64_t timestamp = 0;         // unix seconds
+    uint64_t messages = 0;
+    std::vector<std::pair<std::string, double>> metrics;
+    std::vector<std::pair<std::string, double>> counters;      // per message
+    std::vector<double> latencySamples;                         // ns, strided subsample
+
+    // Name, commit, clock and wall time filled in for this binary
+    static BenchmarkRecord make(std::string name, uint64_t messages);
+
+    void addMetric(const std::string& key, double value) { metrics.emplace_back(key, value); }
+    void addCounters(const PerfReading& reading);
+    // Throughput from a timed interval plus percentiles of the tick samples
+    void addParseStats(double seconds, const uint64_t* samples, uint64_t sampleCount);
+
+    std::optional<double> metric(const std::string& key) const;
+    std::optional<double> counter(const std::string& key) const;
+
+    std::string toJson() const;
+    static std::optional<BenchmarkRecord> fromJson(const std::string& line);
+
+    // Appends one line; false if the file cannot be opened
+    static bool append(const std::string& path, const BenchmarkRecord& record);
+    // Every parseable line; throws runtime_error if the file cannot be read
+    static std::vector<BenchmarkRecord> load(const std::string& path);
+
+    static constexpr size_t MAX_LATENCY_SAMPLES = 2000;
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+// A clock is a static tick source with a known rate. Hot paths (parse
+// latency, throttles, timers, child stamps) read EngineClock, picked at
+// compile time by ENGINE_CLOCK_{TSC,MONOTONIC,SIM}, so a backtest can swap
+// in SimClock and run faster than real time with reproducible results.
+template <typename C>
+concept Clock = requires {
+    { C::now() } -> std::same_as<uint64_t>;
+    { C::ticksPerSecond() } -> std::same_as<uint64_t>;
+    { C::simulated } -> std::convertible_to<bool>;
+};
+
+// Raw invariant TSC; rate calibrated once against the OS monotonic clock
+struct TscClock {
+    static constexpr bool simulated = false;
+    static uint64_t now() { return __rdtsc(); }
+    static uint64_t ticksPerSecond();
+};
+
+// CLOCK_MONOTONIC through the vDSO on POSIX, QueryPerformanceCounter on Windows
+struct MonotonicClock {
+    static constexpr bool simulated = false;
+    static uint64_t now();
+    static uint64_t ticksPerSecond();
+};
+
+// Nanoseconds that only move when the driver says so. Replays set it to the
+// recorded unix-ns timestamp of each event; tests advance it explicitly.
+struct SimClock {
+    static constexpr bool simulated = true;
+    static uint64_t now() { return time_.load(std::memory_order_relaxed); }
+    static uint64_t ticksPerSecond() { return 1'000'000'000; }
+    static void set(uint64_t ns) { time_.store(ns, std::memory_order_relaxed); }
+    static void advance(uint64_t ns) { time_.fetch_add(ns, std::memory_order_relaxed); }
+
+private:
+    static inline std::atomic<uint64_t> time_{0};
+};
+
+static_assert(Clock<TscClock> && Clock<MonotonicClock> && Clock<SimClock>);
+
+#if defined(ENGINE_CLOCK_SIM)
+using EngineClock = SimClock;
+#elif defined(ENGINE_CLOCK_MONOTONIC)
+using EngineClock = MonotonicClock;
+#else
+using EngineClock = TscClock;
+#endif
+
+template <Clock C = EngineClock>
+double ticksToNanos(uint64_t ticks) {
+    return double(ticks) * 1e9 / double(C::ticksPerSecond());
+}
+
+template <Clock C = EngineClock>
+uint64_t nanosToTicks(uint64_t ns) {
+    return static_cast<uint64_t>(double(ns) * double(C::ticksPerSecond()) / 1e9);
+}
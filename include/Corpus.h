@@ -0,0 +1,38 @@
+#pragma once
+#include <LoadGenerator.h>
+#include <MappedFile.h>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+struct CorpusHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t messageSize;
+    uint32_t _reserved;
+    uint64_t count;
+    uint64_t dataOffset;    // cache-line aligned start of the message stream
+};
+
+// Pre-serialized WireOrder stream for benchmarks: generated once from a
+// scenario, then mapped and prefaulted so the timed loop only parses.
+class Corpus {
+public:
+    static constexpr uint32_t MAGIC = 0x50434C4C;  // "LLCP"
+    static constexpr uint32_t VERSION = 1;
+
+    // Streams the scenario to `path` through MessageParser::serializeTo
+    static bool write(const std::string& path, const Scenario& scenario);
+
+    // Throws std::runtime_error on a missing, truncated or foreign file, or a
+    // data offset inside the header or off a cache line
+    explicit Corpus(const std::string& path);
+
+    [[nodiscard]] const uint8_t* messages() const;
+    [[nodiscard]] uint64_t count() const;
+    [[nodiscard]] size_t messageSize() const;
+
+private:
+    MappedFile file_;
+    const CorpusHeader* header_;
+};
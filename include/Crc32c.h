@@ -0,0 +1,15 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+// CRC32C (Castagnoli). Uses the SSE4.2 crc32 instruction when the target
+// supports it, with three interleaved streams for buffers of a few hundred
+// bytes or more; falls back to a byte-wise table otherwise.
+class Crc32c {
+public:
+    // Standard CRC32C (pre/post inverted); pass a previous result as `crc` to extend it
+    static uint32_t compute(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+    // Single-stream variant for short inputs such as one WireOrder
+    static uint32_t computeShort(const uint8_t* data, size_t size, uint32_t crc = 0);
+};
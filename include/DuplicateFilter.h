@@ -0,0 +1,53 @@
+#pragma once
+#include <LiveOrderIndex.h>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Bloom filter whose k = 8 probe bits for a key all fall in one 64-byte
+// block (one bit per 64-bit word), so a lookup touches a single cache line.
+class BlockedBloomFilter {
+public:
+    BlockedBloomFilter(size_t expectedKeys, double bitsPerKey = 16.0);
+
+    // Returns true if the key may have been added before; adds it either way
+    bool testAndAdd(uint64_t hash);
+    [[nodiscard]] bool mayContain(uint64_t hash) const;
+    void clear();
+
+    [[nodiscard]] size_t sizeBytes() const;
+
+private:
+    struct alignas(64) Block {
+        uint64_t words[8];
+    };
+
+    size_t blockIndex(uint64_t hash) const;
+
+    std::vector<Block> blocks_;
+};
+
+// Replayed / retransmitted order_id detection. The bloom filter covers every
+// id seen this session; a positive is confirmed against the live-order index,
+// so only ids that are both maybe-seen and still live are reported.
+class DuplicateDetector {
+public:
+    DuplicateDetector(size_t expectedIds, size_t maxLiveOrders, double bitsPerId = 16.0);
+
+    // Returns true if orderId duplicates a live order; otherwise records it as live
+    bool isDuplicate(uint64_t orderId);
+
+    // Order left the book (filled / cancelled / rejected downstream)
+    void onOrderClosed(uint64_t orderId);
+
+    [[nodiscard]] uint64_t duplicates() const;
+    [[nodiscard]] uint64_t bloomPositives() const;
+    [[nodiscard]] uint64_t untracked() const;
+
+private:
+    BlockedBloomFilter bloom_;
+    LiveOrderIndex live_;
+    uint64_t duplicates_ = 0;
+    uint64_t bloomPositives_ = 0;
+    uint64_t untracked_ = 0;
+};
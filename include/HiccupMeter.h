@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <Clock.h>
+#include <LatencyHistogram.h>
+#include <MessageParser.h>
+
+// A stretch in which the meter could not read the clock, in EngineClock ticks
+struct Hiccup {
+    uint64_t start;
+    uint64_t ticks;
+};
+
+struct HiccupCorrelation {
+    uint64_t outliers = 0;              // parser samples above the outlier threshold
+    uint64_t explained = 0;             // ...overlapping a hiccup
+    uint64_t worstExplainedNs = 0;
+    uint64_t worstUnexplainedNs = 0;    // tail no observed hiccup accounts for
+};
+
+// Reads the clock back to back and records every gap above a threshold:
+// time the CPU spent somewhere else (interrupts, SMIs, preemption, frequency
+// or C-state transitions). Two ways to run it:
+//   thread: start() spins on its own, ideally pinned, thread that does no
+//           other work, so every gap is the platform's; but only stalls
+//           that reach the meter's core (SMIs, system-wide pauses), not
+//           interrupts or preemption on another core
+//   hook:   arm() then tick() once per iteration of a hot loop; no spare
+//           core needed, but gaps include the loop's own work
+class HiccupMeter {
+public:
+    explicit HiccupMeter(uint64_t thresholdNs = 1000, size_t maxEvents = 65'536);
+    ~HiccupMeter();
+    HiccupMeter(const HiccupMeter&) = delete;
+    HiccupMeter& operator=(const HiccupMeter&) = delete;
+
+    // Thread mode; cpu < 0 leaves the thread unpinned. False if pinning failed.
+    bool start(int cpu = -1);
+    void stop();
+
+    // Hook mode
+    void arm() { last_ = EngineClock::now(); }
+    void tick() {
+        uint64_t now = EngineClock::now();
+        if (now - last_ > thresholdTicks_) [[unlikely]] record(last_, now);
+        last_ = now;
+        ++reads_;
+    }
+
+    // Read these after stop() in thread mode
+    const LatencyHistogram& histogram() const { return histogram_; }    // gap lengths, ns
+    const std::vector<Hiccup>& events() const { return events_; }       // first maxEvents, in time order
+    uint64_t reads() const { return reads_; }
+    uint64_t dropped() const { return dropped_; }
+
+    // How many parser outliers overlap a hiccup (both lists in time order)
+    static HiccupCorrelation correlate(const std::vector<Hiccup>& hiccups, const std::vector<LatencyOutlier>& outliers);
+
+private:
+    void record(uint64_t from, uint64_t to);
+
+    uint64_t thresholdTicks_;
+    size_t maxEvents_;
+    uint64_t last_ = 0;
+    uint64_t reads_ = 0;
+    uint64_t dropped_ = 0;
+    LatencyHistogram histogram_;
+    std::vector<Hiccup> events_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+};
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// HDR-style log-linear histogram with fixed memory and O(1) record. Values
+// below 2^SUB_BITS are exact; each higher power of two is split into
+// 2^(SUB_BITS-1) buckets, so reported values are within 1% of the true value.
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BITS = 8;
+    static constexpr unsigned MAX_BITS = 44;    // larger values clamp into the last bucket
+
+    LatencyHistogram();
+
+    void record(uint64_t value);
+    void merge(const LatencyHistogram& other);
+    void reset();
+
+    // Highest value equivalent to the p-th percentile, p in [0, 100]
+    [[nodiscard]] uint64_t percentile(double p) const;
+    [[nodiscard]] uint64_t count() const;
+    [[nodiscard]] uint64_t min() const;
+    [[nodiscard]] uint64_t max() const;
+    [[nodiscard]] double mean() const;
+
+    // One line per power-of-two band from the lowest to the highest occupied
+    // one: range, count and a bar scaled to the fullest band
+    void print(std::ostream& out, const std::string& indent = "") const;
+
+private:
+    static size_t bucketIndex(uint64_t value);
+    static uint64_t bucketUpper(size_t index);
+
+    std::vector<uint64_t> counts_;
+    uint64_t count_ = 0;
+    uint64_t min_ = UINT64_MAX;
+    uint64_t max_ = 0;
+    double sum_ = 0.0;
+};
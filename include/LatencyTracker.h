@@ -1,3 +1,4 @@
+#pragma once
 #include <iostream>
 #include <vector>
 #include <numeric>
@@ -5,9 +6,22 @@
 #include <inttypes.h>
 #include <MessageParser.h>
 
+struct LatencySummary {
+    uint64_t count = 0;
+    uint64_t min = 0;       // all in ns
+    uint64_t median = 0;
+    double avg = 0.0;
+    uint64_t p99 = 0;
+    uint64_t p999 = 0;
+    uint64_t max = 0;
+};
+
 class LatencyTracker {
     
     public:
         void analyzeLatencies(uint64_t (&timestampArr)[MessageParser::MAX_SAMPLES], uint64_t count);
 
-};
\ No newline at end of file
+        // Percentiles of `count` clock-tick samples, converted to ns
+        static LatencySummary summarize(const uint64_t* samples, uint64_t count);
+
+};
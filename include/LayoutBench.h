@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <PerfCounters.h>
+
+// Ways of storing a day's parsed orders
+enum class OrderLayout {
+    Aos64,          // std::vector<Order>, one padded cache line per order
+    Compact40,      // naturally aligned AoS without padding or instrument id
+    HotCold32,      // 32-byte hot record (id, symbol, price, qty, side, type) + cold timestamps
+    Soa,            // one array per field
+};
+
+enum class LayoutWorkload {
+    Parse,          // parse the corpus and store every order
+    ScanSymbol,     // count and sum quantity for one symbol
+    SumNotional,    // signed price * quantity over every order
+    RandomAccess,   // id, price and quantity of randomly chosen orders
+};
+
+const char* orderLayoutName(OrderLayout layout);
+const char* layoutWorkloadName(LayoutWorkload workload);
+
+struct LayoutResult {
+    LayoutWorkload workload = LayoutWorkload::Parse;
+    double seconds = 0.0;
+    uint64_t items = 0;         // orders visited
+    uint64_t traffic = 0;       // modeled bytes moved: arrays streamed, or cache lines per random access
+    uint64_t checksum = 0;      // identical across layouts unless one loses data
+    PerfReading counters;
+};
+
+// Runs the same four workloads over one storage layout. The parse workload
+// fills the storage from the corpus, the others then read it back.
+class LayoutBench {
+public:
+    static std::vector<LayoutResult> run(OrderLayout layout, const uint8_t* messages, size_t messageSize,
+                                         uint64_t count, uint64_t lookups, size_t passes);
+
+    // Bytes of storage one order occupies in this layout
+    static size_t bytesPerOrder(OrderLayout layout);
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Exact set of currently live order ids. Open addressing with linear
+// probing over a table sized once at construction; erase uses backward
+// shifting so no tombstones accumulate.
+class LiveOrderIndex {
+public:
+    explicit LiveOrderIndex(size_t maxLiveOrders);
+
+    // Returns false if the id is already present or the index is full
+    bool insert(uint64_t orderId);
+    bool erase(uint64_t orderId);
+    [[nodiscard]] bool contains(uint64_t orderId) const;
+
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] size_t capacity() const;
+
+    static uint64_t hash(uint64_t key);
+
+private:
+    static constexpr uint64_t EMPTY = UINT64_MAX;
+
+    std::vector<uint64_t> slots_;
+    size_t mask_;
+    size_t size_ = 0;
+    size_t maxSize_;
+    bool hasEmptyKey_ = false;  // UINT64_MAX is the empty marker, tracked separately
+};
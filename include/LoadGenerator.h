@@ -0,0 +1,95 @@
+#pragma once
+#include <Order.h>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// One reproducible stream of orders. The wire format only carries new
+// orders, so amends are modelled as a resend of a recent order_id: a replace
+// carries a new price and quantity, a cancel carries quantity 0 (which the
+// parser rejects, exercising the reject path). A replay retransmits a recent
+// order unchanged, the case the duplicate id stage screens for.
+struct Scenario {
+    std::string name;
+    uint64_t messages = 1'000'000;
+    uint64_t seed = 1;
+
+    uint32_t symbols = 1;                   // universe size, ranked by popularity
+    double zipfExponent = 1.0;              // 0 = uniform
+
+    double midPrice = 50.0;                 // initial mids spread around this
+    double tickSize = 0.01;
+    uint32_t maxStepTicks = 2;              // random-walk step per message on the symbol hit
+    uint32_t maxOffsetTicks = 10;           // limit price distance from mid
+
+    double buyRatio = 0.5;
+    double marketRatio = 0.2;
+    double stopRatio = 0.05;                // the rest are limits
+    uint32_t minQuantity = 1;
+    uint32_t maxQuantity = 1000;
+
+    double cancelRatio = 0.0;
+    double replaceRatio = 0.0;
+    double replayRatio = 0.0;
+
+    uint32_t sessions = 0;                  // senders, throttled per session before parse; 0 = unthrottled
+    double runawayShare = 0.0;              // share of messages sent by session 0, the rest spread evenly
+
+    uint64_t interarrivalNs = 1'000;        // stamp spacing inside a burst
+    uint64_t burstLength = 0;               // messages per burst, 0 = no quiet phases
+    uint64_t quietNs = 0;                   // pause between bursts
+};
+
+class LoadGenerator {
+public:
+    explicit LoadGenerator(const Scenario& scenario);
+
+    Order next();
+    [[nodiscard]] bool done() const;
+
+    // Quiet time due before the next message (0 inside a burst); clears it
+    uint64_t takePause();
+
+    [[nodiscard]] const Scenario& scenario() const;
+    [[nodiscard]] uint64_t generated() const;
+    [[nodiscard]] uint64_t cancels() const;
+    [[nodiscard]] uint64_t replaces() const;
+    [[nodiscard]] uint64_t replays() const;
+    [[nodiscard]] uint32_t session() const;    // sender of the last next() order
+
+    static std::vector<Scenario> defaultScenarios();
+
+private:
+    struct LiveRef {
+        uint64_t orderId;
+        uint32_t symbol;
+        Side side;
+        OrderType type;
+        double price;
+        uint32_t quantity;
+    };
+
+    static constexpr size_t RECENT_ORDERS = 4096;
+
+    uint64_t nextRandom();
+    double uniform();
+    uint64_t below(uint64_t bound);
+    uint32_t pickSymbol();
+    double priceFor(uint32_t symbol, Side side, OrderType type);
+
+    Scenario scenario_;
+    uint64_t rng_;
+    std::vector<double> zipfCdf_;
+    std::vector<char> symbolNames_;         // 8 bytes per symbol
+    std::vector<double> mids_;
+    std::vector<LiveRef> recent_;           // ring of recently sent orders
+    uint64_t nextOrderId_ = 1;
+    uint64_t timestamp_ = 0;
+    uint64_t generated_ = 0;
+    uint64_t pendingPause_ = 0;
+    uint64_t cancels_ = 0;
+    uint64_t replaces_ = 0;
+    uint64_t replays_ = 0;
+    uint32_t session_ = 0;
+};
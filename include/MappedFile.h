@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// Read-only memory mapping of a whole file
+class MappedFile {
+public:
+    // Throws std::runtime_error if the file cannot be opened or mapped.
+    // `prefault` populates the page tables up front so first access never faults.
+    explicit MappedFile(const std::string& path, bool prefault = false);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    [[nodiscard]] const uint8_t* data() const;
+    [[nodiscard]] size_t size() const;
+
+private:
+    void release();
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32) || defined(_WIN64)
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+#endif
+};
@@ -1,35 +1,71 @@
 #pragma once 
 
 #include <Order.h>
+#include <SecurityMaster.h>
 #include <optional>
 #include <vector>
 
+// A parse that took longer than the outlier threshold, in EngineClock ticks
+struct LatencyOutlier {
+    uint64_t start;
+    uint64_t ticks;
+};
+
 class MessageParser {
     
     public:
 
-    static const size_t MAX_SAMPLES = 1'000'000;
+    static constexpr size_t MAX_SAMPLES = 1'000'000;
+    static constexpr size_t MAX_OUTLIERS = 65'536;
     
     std::optional<Order> parse(const uint8_t* data, size_t size);
     std::vector<uint8_t> serialize(const Order& order);
+
+    // Batch variants: messages are `stride` bytes apart, invalid ones are skipped.
+    // Passing `crcFailures` verifies the CRC32C trailer following each message.
+    size_t parseBatch(const uint8_t* data, size_t count, size_t stride, Order* out, size_t* crcFailures = nullptr);
+    void serializeTo(const Order& order, uint8_t* out);
+
+    // Same operations over the naturally aligned 40-byte AlignedWireOrder layout
+    std::optional<Order> parseAligned(const uint8_t* data, size_t size);
+    size_t parseBatchAligned(const uint8_t* data, size_t count, size_t stride, Order* out, size_t* crcFailures = nullptr);
+    void serializeAlignedTo(const Order& order, uint8_t* out);
+
+    // With a security master attached, symbols are validated by lookup and
+    // parsed orders carry their instrument_id
+    void setSecurityMaster(const SecurityMaster* master);
+
     void recordLatency(uint64_t (&timestampArr)[MAX_SAMPLES], uint64_t latency);
+    // Samples are per thread: these see only the calling thread's window
     uint64_t getIndex();
+    static void resetLatency();   // start a fresh sample window, e.g. per scenario
     static uint64_t (&getTimestampList())[MAX_SAMPLES];
     size_t getMaxSamples();
 
+    // Per-thread log of samples above `ns` with their start time, to line tail
+    // latency up with HiccupMeter gaps; 0 (the default) turns it off.
+    // Cleared by resetLatency, keeps the first MAX_OUTLIERS.
+    static void setOutlierThreshold(uint64_t ns);
+    static const std::vector<LatencyOutlier>& getOutliers();
+
     private:
-        // Byte-order helpers
-        uint64_t hton64(uint64_t value);
-        uint64_t ntoh64(uint64_t value);
-        uint64_t doubleToUint64(double value);
-        double uint64ToDouble(uint64_t value);
+        // Shared by the packed and aligned wire layouts
+        template <typename Wire>
+        std::optional<Order> parseImpl(const uint8_t* data, size_t size);
+        template <typename Wire, size_t Alignment>
+        size_t parseBatchImpl(const uint8_t* data, size_t count, size_t stride, Order* out, size_t* crcFailures);
+        template <typename Wire>
+        void serializeImpl(const Order& order, uint8_t* out);
 
         // Validation helpers
         bool validateSymbol(const char* symbol);
         bool validatePrice(double price);
         bool validateQuantity(uint32_t qty);
+        bool validateSymbolBranchless(const char* symbol);
 
         // Timestamp
         uint64_t captureTimestamp();
 
+        const SecurityMaster* securityMaster_ = nullptr;
+
 };
\ No newline at end of file
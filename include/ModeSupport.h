@@ -0,0 +1,90 @@
+#pragma once
+#include <BenchmarkRecord.h>
+#include <DuplicateFilter.h>
+#include <Order.h>
+#include <PerfCounters.h>
+#include <PlatformCheck.h>
+#include <ResultSink.h>
+#include <RiskCheck.h>
+#include <SecurityMaster.h>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Option parsing, pipeline stages and reporting shared by the benchmark
+// harness modes (Modes.h)
+
+// Rate over a timed window; 0 when nothing was timed
+double perSecond(double amount, double seconds);
+
+// Constructs the selected sink and hands it to `run`
+template <typename F>
+void withSink(SinkKind kind, F&& run) {
+    switch (kind) {
+        case SinkKind::Discard: { DiscardSink sink; run(sink); break; }
+        case SinkKind::Ring:    { RingSink sink; run(sink); break; }
+        case SinkKind::Queue:   { QueueSink sink; run(sink); break; }
+    }
+}
+
+// Removes "--sink <kind>" from the arguments; discard when absent
+std::optional<SinkKind> takeSinkOption(std::vector<std::string>& args);
+
+// Removes "<flag> <value>" from the arguments; false if the value is missing
+bool takeValueOption(std::vector<std::string>& args, const std::string& flag, std::string& value);
+
+// Removes a bare flag from the arguments; true if it was there
+bool takeFlag(std::vector<std::string>& args, const std::string& flag);
+
+// Where runs are recorded and how often each one repeats
+struct RecordOptions {
+    std::string path;           // empty: print only
+    size_t repeat = 1;
+};
+
+bool takeRecordOptions(std::vector<std::string>& args, RecordOptions& options);
+
+void printCounters(const PerfReading& reading, uint64_t messages);
+void saveRecord(const RecordOptions& options, const BenchmarkRecord& record);
+
+// Pipeline stages around parse, set from --dedup, --risk and --secmaster
+struct StageOptions {
+    bool dedup = false;
+    bool risk = false;
+    std::string secmasterPath;
+    std::optional<SecurityMaster> secmaster;
+};
+
+// Removes the stage options from the arguments; false if a value is missing.
+// The security master is mapped later, by load(), inside the mode's error handling.
+bool takeStageOptions(std::vector<std::string>& args, StageOptions& options);
+
+// Maps the security master, if any; throws runtime_error on a bad file
+const SecurityMaster* loadSecurityMaster(StageOptions& options);
+
+// Limits for the --risk stage. Quantity, notional and position limits are
+// bench values, tight enough that generated flow trips them now and then;
+// with a security master each instrument takes its tick size, lot size and
+// price band from it instead of the fixed band. Orders run as account 0.
+RiskLimits benchRiskLimits(const SecurityMaster* master);
+
+// The security master's id when the parser has one, else every symbol shares slot 0
+uint32_t riskInstrument(const Order& order);
+
+// The --dedup stage: the bloom filter is sized for every message of the run,
+// and every order stays live until the risk stage rejects it (nothing fills)
+DuplicateDetector benchDuplicateDetector(uint64_t messages);
+
+void printDuplicateCounters(const DuplicateDetector& dedup);
+void printRiskCounters(const RiskChecker& risk);
+
+// Set by main from --tuning-profile and --strict-tuning before any mode runs
+extern TuningProfile g_tuningProfile;
+extern bool g_strictTuning;
+
+// Measuring modes call this once they know the cpus they will pin to
+// (unpinned ones pass the first allowed cpu): reports differences from the
+// tuning profile and returns false when --strict-tuning should stop the run
+bool tuningAllows(std::vector<unsigned> cpus);
@@ -0,0 +1,16 @@
+#pragma once
+
+// Benchmark harness modes, one per command-line verb. Each driver lives in
+// src/benchmarking/<Mode>Mode.cpp, takes the arguments after the verb and
+// returns the process exit status; main only strips the global options and
+// dispatches.
+int runScenarios(int argc, char** argv);    // scenarios
+int writeCorpus(int argc, char** argv);     // corpus
+int benchCorpus(int argc, char** argv);     // bench
+int scaleCorpus(int argc, char** argv);     // scale
+int runPingPong(int argc, char** argv);     // pingpong
+int routeBench(int argc, char** argv);      // route
+int layoutCorpus(int argc, char** argv);    // layout
+int hiccupCorpus(int argc, char** argv);    // hiccup
+int checkPlatform(int argc, char** argv);   // platform
+int compareRecords(int argc, char** argv);  // compare
@@ -23,7 +23,10 @@ struct alignas(64) Order {
     uint32_t quantity;
     Side side;
     OrderType type;
-    uint8_t _padding[20]{};
+    uint32_t instrument_id = NO_INSTRUMENT;   // set by the parser when a SecurityMaster is attached
+    uint8_t _padding[16]{};
+
+    static constexpr uint32_t NO_INSTRUMENT = UINT32_MAX;
 
     Order(
         uint64_t id = 0,
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+// Time-ordered order ids with no shared state per id:
+//   [63] 0 | [62:22] ms since ID_EPOCH_MS | [21:14] shard | [13:0] sequence
+// Each generator owns a shard, so threads never contend; ids from one shard
+// are strictly increasing and ids across shards sort by millisecond. When a
+// shard exhausts its 16384 ids in a millisecond it borrows the next one
+// instead of waiting. next() re-reads the wall clock only once EngineClock
+// has moved ~60us since the last read; under SimClock the simulated unix-ns
+// time is used directly, so replays produce the same ids.
+class OrderIdGenerator {
+public:
+    static constexpr unsigned SEQUENCE_BITS = 14;
+    static constexpr unsigned SHARD_BITS = 8;
+    static constexpr unsigned TIME_BITS = 41;
+    static constexpr size_t MAX_SHARDS = size_t(1) << SHARD_BITS;
+    static constexpr uint64_t ID_EPOCH_MS = 1704067200000ULL;   // 2024-01-01T00:00:00Z
+
+    explicit OrderIdGenerator(uint8_t shard);
+
+    uint64_t next();
+    uint64_t next(uint64_t unixMs);
+
+    [[nodiscard]] uint8_t shard() const;
+
+    // Calling thread's generator, from a process-wide pool (one locked claim
+    // per thread). The shard returns to the pool when the thread exits, so
+    // only MAX_SHARDS threads may hold one at once; past that this throws.
+    static OrderIdGenerator& local();
+
+    static uint64_t timestampMs(uint64_t id);  // unix ms
+    static uint8_t shardOf(uint64_t id);
+    static uint32_t sequenceOf(uint64_t id);
+
+private:
+    static uint64_t nowMs();
+
+    uint64_t cachedMs_ = 0;     // unix ms at cachedTick_
+    uint64_t cachedTick_ = 0;
+    uint64_t refreshTicks_;
+    uint64_t lastMs_ = 0;       // relative to ID_EPOCH_MS
+    uint32_t sequence_ = 0;
+    uint8_t shard_;
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+
+struct PerfReading {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t cacheMisses = 0;       // last-level cache misses
+    uint64_t branchMisses = 0;
+    bool valid = false;             // false when the counters could not be opened
+};
+
+// Hardware counters for the calling thread (user space only), read as one
+// perf_event group so all four cover the same interval. Opening fails
+// quietly on Windows, in most containers and with perf_event_paranoid > 2;
+// readings are then invalid and benchmarks simply omit them.
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return fds_[0] >= 0; }
+
+    void start();                   // zero and enable
+    void pause();
+    void resume();
+    PerfReading stop();             // disable and read
+
+private:
+    static constexpr int EVENTS = 4;
+    int fds_[EVENTS] = {-1, -1, -1, -1};
+};
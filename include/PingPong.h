@@ -0,0 +1,29 @@
+#pragma once
+#include <LatencyHistogram.h>
+#include <cstdint>
+#include <cstddef>
+
+enum struct HandoffQueue : uint8_t {
+    SPSC,           // spscqueue::SPSCQueue
+    MutexCondVar,   // std::queue + mutex, consumer sleeps on a condvar
+    MutexSpin       // std::queue + mutex, consumer polls
+};
+
+const char* handoffQueueName(HandoffQueue queue);
+
+struct PingPongResult {
+    LatencyHistogram oneWay;        // ns, stamped by the sender and read by the receiver
+    LatencyHistogram roundTrip;     // ns, there and back on the sender's clock
+};
+
+// Bounces a payload between two pinned threads through a pair of queues.
+// One-way latency relies on a clock that is consistent across cores
+// (invariant TSC or CLOCK_MONOTONIC).
+class PingPong {
+public:
+    // Payload sizes supported: 8, 16, 32 bytes, or 64 for a full Order
+    static bool supportsPayload(size_t bytes);
+
+    static PingPongResult run(HandoffQueue queue, size_t payloadBytes, unsigned cpuA, unsigned cpuB,
+                              size_t iterations, size_t warmup);
+};
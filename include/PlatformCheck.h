@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Host settings a low-latency run expects. Empty strings and false flags
+// mean "don't care". Loaded from `key = value` lines, '#' comments:
+//   governor = performance
+//   turbo = off                      (on | off)
+//   isolated = true                  (cores listed in isolcpus)
+//   nohz_full = true                 (cores listed in nohz_full)
+//   thp = never                      (never | madvise | always)
+//   irq_free = true                  (no IRQ may target the cores)
+//   max_cstate_latency_us = 10       (deeper idle states must be disabled)
+struct TuningProfile {
+    std::string governor = "performance";
+    std::string turbo;
+    bool isolated = true;
+    bool nohzFull = true;
+    std::string thp = "never";
+    bool irqFree = true;
+    std::optional<uint32_t> maxCStateLatencyUs = 10;
+
+    // Throws runtime_error on an unreadable file, unknown key or bad value
+    static TuningProfile load(const std::string& path);
+};
+
+enum class CheckStatus {
+    Pass,
+    Fail,
+    Unknown,    // setting not exposed here (container, VM, other OS)
+};
+
+struct PlatformFinding {
+    std::string check;
+    int cpu = -1;               // -1 for host-wide settings
+    std::string expected;
+    std::string actual;
+    CheckStatus status = CheckStatus::Unknown;
+};
+
+// Compares the host against a profile for the cores our threads run on,
+// reading /sys and /proc (Linux only; everything is Unknown elsewhere)
+class PlatformCheck {
+public:
+    static std::vector<PlatformFinding> run(const TuningProfile& profile, const std::vector<unsigned>& cpus);
+
+    // Failures only unless `all`, cpus with the same result on one line;
+    // returns the number of failed groups
+    static size_t report(const std::vector<PlatformFinding>& findings, std::ostream& out, bool all);
+
+    // "0-3,8,10-11" <-> {0, 1, 2, 3, 8, 10, 11}
+    static std::vector<unsigned> parseCpuList(const std::string& list);
+    static std::string formatCpuList(const std::vector<unsigned>& cpus);
+};
@@ -0,0 +1,94 @@
+#pragma once
+#include <Order.h>
+#include <templates/spsc_queue/SPSCQueue.h>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Benchmark output stages. Each keeps memory constant however many orders
+// pass through and folds every order into a checksum so the compiler cannot
+// drop the parse work feeding it.
+inline uint64_t mixOrder(uint64_t checksum, const Order& o) {
+    return checksum * 31 + (o.order_id ^ o.quantity ^ o.timestamp_ns);
+}
+
+enum struct SinkKind : uint8_t {
+    Discard,    // checksum only
+    Ring,       // copies into a fixed ring that is overwritten
+    Queue       // forwards through an SPSCQueue to a consumer thread
+};
+
+std::optional<SinkKind> parseSinkKind(const std::string& name);
+const char* sinkName(SinkKind kind);
+
+class DiscardSink {
+public:
+    void consume(const Order& o) {
+        checksum_ = mixOrder(checksum_, o);
+        ++count_;
+    }
+    void finish() {}
+
+    [[nodiscard]] uint64_t checksum() const { return checksum_; }
+    [[nodiscard]] uint64_t count() const { return count_; }
+
+private:
+    uint64_t checksum_ = 0;
+    uint64_t count_ = 0;
+};
+
+class RingSink {
+public:
+    explicit RingSink(size_t capacity = 65536);
+
+    void consume(const Order& o) {
+        ring_[count_ & mask_] = o;
+        checksum_ = mixOrder(checksum_, o);
+        ++count_;
+    }
+    void finish() {}
+
+    [[nodiscard]] uint64_t checksum() const { return checksum_; }
+    [[nodiscard]] uint64_t count() const { return count_; }
+    [[nodiscard]] const Order& last() const { return ring_[(count_ - 1) & mask_]; }
+
+private:
+    std::vector<Order> ring_;
+    size_t mask_;
+    uint64_t checksum_ = 0;
+    uint64_t count_ = 0;
+};
+
+// The consumer thread checksums what it pops; consume() spins while the queue
+// is full, so the benchmark includes backpressure from the downstream stage
+class QueueSink {
+public:
+    explicit QueueSink(size_t capacity = 65536);
+    ~QueueSink();
+
+    QueueSink(const QueueSink&) = delete;
+    QueueSink& operator=(const QueueSink&) = delete;
+
+    void consume(const Order& o) {
+        while (!queue_.push(o)) {}
+        ++count_;
+    }
+    // Waits for the consumer to drain the queue
+    void finish();
+
+    [[nodiscard]] uint64_t checksum() const { return checksum_.load(std::memory_order_acquire); }
+    [[nodiscard]] uint64_t count() const { return count_; }
+
+private:
+    void drain();
+
+    spscqueue::SPSCQueue<Order> queue_;
+    std::atomic<bool> stop_{false};
+    std::atomic<uint64_t> checksum_{0};
+    uint64_t count_ = 0;
+    std::thread consumer_;
+};
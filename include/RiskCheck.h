@@ -0,0 +1,80 @@
+#pragma once
+#include <Order.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Bit positions in RiskResult::rejectMask
+enum struct RiskReject : uint8_t {
+    UnknownInstrument = 0,
+    UnknownAccount = 1,
+    OrderQuantity = 2,      // above instrument or account max order size
+    PriceBand = 3,          // outside the instrument's [minPrice, maxPrice]
+    OrderNotional = 4,      // price * qty above instrument or account max
+    PositionLimit = 5,      // projected |net position| above instrument max
+    CreditLimit = 6,        // projected gross notional above account max
+    BadSide = 7,            // side byte neither Buy nor Sell
+    TickSize = 8,           // price not a multiple of the instrument's tick
+    LotSize = 9,            // quantity not a multiple of the instrument's lot
+    Count = 10
+};
+
+const char* riskRejectName(RiskReject reason);
+
+struct InstrumentLimits {
+    uint32_t maxOrderQty = 0;
+    double minPrice = 0.0;
+    double maxPrice = 0.0;
+    double maxOrderNotional = 0.0;
+    int64_t maxPosition = 0;
+    double tickSize = 0.0;      // 0: any price
+    uint32_t lotSize = 1;
+};
+
+struct AccountLimits {
+    uint32_t maxOrderQty = 0;
+    double maxOrderNotional = 0.0;
+    double maxGrossNotional = 0.0;
+};
+
+// Limit tables indexed by dense instrument / account id
+struct RiskLimits {
+    std::vector<InstrumentLimits> instruments;
+    std::vector<AccountLimits> accounts;
+};
+
+struct RiskResult {
+    bool accepted;
+    uint32_t rejectMask;
+};
+
+// Pre-trade checks. Every limit is evaluated on every order and folded into
+// a reject mask, so the cost does not depend on which check fails.
+class RiskChecker {
+public:
+    explicit RiskChecker(const RiskLimits& limits);
+
+    RiskResult check(const Order& order, uint32_t instrumentId, uint32_t accountId);
+
+    // Switches to a newer limit table (see RiskLimitStore); exposure carries over
+    void setLimits(const RiskLimits& limits);
+
+    // Returns the exposure taken by a previously accepted order (cancel / reject downstream)
+    void release(const Order& order, uint32_t instrumentId, uint32_t accountId);
+
+    [[nodiscard]] int64_t position(uint32_t instrumentId) const;
+    [[nodiscard]] double grossNotional(uint32_t accountId) const;
+
+    [[nodiscard]] uint64_t checked() const;
+    [[nodiscard]] uint64_t rejected() const;
+    [[nodiscard]] uint64_t rejectCount(RiskReject reason) const;
+
+private:
+    const RiskLimits* limits_;
+    std::vector<int64_t> positions_;
+    std::vector<double> grossNotional_;
+
+    uint64_t checked_ = 0;
+    uint64_t rejected_ = 0;
+    std::array<uint64_t, static_cast<size_t>(RiskReject::Count)> rejectCounts_{};
+};
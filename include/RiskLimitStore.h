@@ -0,0 +1,42 @@
+#pragma once
+#include <RiskCheck.h>
+#include "templates/epoch/EpochManager.h"
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+// Versioned, read-mostly home for RiskLimits. An operator thread publishes a
+// new immutable table with one pointer swap; the old one is freed once every
+// registered reader has passed a quiescent point (between batches) since.
+//
+// Reader loop:
+//     const RiskLimits* limits = store.current();
+//     checker.setLimits(*limits);
+//     ... check a batch ...
+//     store.quiescent(reader);
+class RiskLimitStore {
+public:
+    static constexpr size_t MAX_READERS = 16;
+
+    explicit RiskLimitStore(RiskLimits initial);
+    ~RiskLimitStore();
+
+    RiskLimitStore(const RiskLimitStore&) = delete;
+    RiskLimitStore& operator=(const RiskLimitStore&) = delete;
+
+    // Operator side
+    void publish(RiskLimits next);
+    size_t reclaim();
+    [[nodiscard]] uint64_t version() const;
+    [[nodiscard]] size_t pendingReclaim() const;
+
+    // Reader side; the returned table stays valid until the reader's next quiescent()
+    size_t registerReader();
+    void unregisterReader(size_t reader);
+    const RiskLimits* current() const;
+    void quiescent(size_t reader);
+
+private:
+    std::atomic<const RiskLimits*> current_;
+    epoch::EpochManager<MAX_READERS> epochs_;
+};
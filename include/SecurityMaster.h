@@ -0,0 +1,68 @@
+#pragma once
+#include <MappedFile.h>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+// One instrument's reference data; its position in the file is its instrument id
+struct InstrumentRef {
+    char symbol[8];
+    double tickSize;
+    uint32_t lotSize;
+    uint32_t _padding;
+    double minPrice;
+    double maxPrice;
+};
+
+static_assert(sizeof(InstrumentRef) == 40, "InstrumentRef must be exactly 40 bytes");
+
+// Security master file layout (host byte order, every section 8-byte aligned):
+//   SecurityMasterHeader
+//   InstrumentRef   instruments[count]
+//   uint32_t        displacements[bucketCount]
+//   uint32_t        slots[slotCount]           (instrument id, or NOT_FOUND)
+struct SecurityMasterHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t bucketCount;
+    uint32_t slotCount;
+    uint32_t _reserved;
+    uint64_t instrumentsOffset;
+    uint64_t displacementsOffset;
+    uint64_t slotsOffset;
+};
+
+// Memory-mapped security master with a perfect-hash symbol index
+// (hash-and-displace, built offline by SecMasterConvert)
+class SecurityMaster {
+public:
+    static constexpr uint32_t NOT_FOUND = UINT32_MAX;
+    static constexpr uint32_t MAGIC = 0x4C4C534D; // "LLSM"
+    static constexpr uint32_t VERSION = 1;
+
+    // Maps and validates the file (offsets, hash slots, each instrument as
+    // readCsv does); throws std::runtime_error on a bad file
+    explicit SecurityMaster(const std::string& path);
+
+    // Instrument id for an 8-byte, NUL-padded symbol, or NOT_FOUND
+    [[nodiscard]] uint32_t lookup(const char* symbol) const;
+    [[nodiscard]] const InstrumentRef& instrument(uint32_t id) const;
+    [[nodiscard]] size_t size() const;
+
+    // Builds the perfect hash and writes a security master file; returns false on I/O error
+    static bool writeFile(const std::string& path, const std::vector<InstrumentRef>& instruments);
+
+    // Parses `symbol,tick_size,lot_size,min_price,max_price` lines (header line optional);
+    // nullopt on a malformed row, tick_size <= 0, lot_size 0 or min_price > max_price
+    static std::optional<std::vector<InstrumentRef>> readCsv(const std::string& path);
+
+private:
+    MappedFile file_;
+    const SecurityMasterHeader* header_;
+    const InstrumentRef* instruments_;
+    const uint32_t* displacements_;
+    const uint32_t* slots_;
+};
@@ -0,0 +1,58 @@
+#pragma once
+#include <SmartOrderRouter.h>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+struct VenueFill {
+    uint64_t order_id;
+    uint32_t instrumentId;
+    uint8_t venue;
+    Side side;
+    double price;
+    uint32_t filledQty;
+    uint32_t leavesQty;
+};
+
+// Local stand-in for an exchange: owns the sender queue the router feeds,
+// matches each child against a displayed top of book that refills to its
+// configured depth once taken out, and reports quotes and ack latency
+// (queueing time + fixed latency + seeded jitter) back to the router.
+// Unfilled quantity is reported as leaves; there is no resting book.
+class SimulatedVenue {
+public:
+    using FillSink = std::function<void(const VenueFill&)>;
+
+    SimulatedVenue(SmartOrderRouter& router, const VenueConfig& config, size_t maxInstruments,
+                   size_t queueCapacity, uint64_t latencyTicks, uint64_t jitterTicks, uint64_t seed,
+                   FillSink sink = nullptr);
+
+    SimulatedVenue(const SimulatedVenue&) = delete;
+    SimulatedVenue& operator=(const SimulatedVenue&) = delete;
+
+    // Sets the displayed quote (and refill depth) and publishes it to the router
+    void setQuote(uint32_t instrumentId, const VenueQuote& quote);
+
+    // Matches every queued child; returns the number processed
+    size_t poll(uint64_t nowTick);
+
+    [[nodiscard]] uint8_t id() const;
+    [[nodiscard]] uint64_t filledQty() const;
+    [[nodiscard]] uint64_t ordersReceived() const;
+
+private:
+    uint64_t nextJitter();
+
+    SmartOrderRouter::VenueQueue queue_;
+    SmartOrderRouter& router_;
+    std::vector<VenueQuote> depth_;     // refill template per instrument
+    std::vector<VenueQuote> book_;      // currently displayed
+    uint64_t latencyTicks_;
+    uint64_t jitterTicks_;
+    uint64_t rng_;
+    uint64_t filledQty_ = 0;
+    uint64_t ordersReceived_ = 0;
+    FillSink sink_;
+    uint8_t id_;
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <Order.h>
+#include <templates/spsc_queue/SPSCQueue.h>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+struct VenueQuote {
+    double bidPrice = 0.0;
+    double askPrice = 0.0;
+    uint32_t bidSize = 0;
+    uint32_t askSize = 0;
+};
+
+struct VenueConfig {
+    double feePerShare = 0.0;       // negative for a rebate
+};
+
+struct RouteResult {
+    uint32_t children = 0;
+    uint32_t routedQty = 0;         // sent against displayed liquidity
+    uint32_t restingQty = 0;        // limit residual posted on the cheapest venue
+    uint32_t unroutedQty = 0;       // no liquidity within the limit, or sender queue full
+};
+
+// Splits parent orders across up to MAX_VENUES venues. Each venue contributes
+// its top of book for the instrument, a fee and a latency EWMA (fed by acks);
+// venues are ranked by expected fill cost = price + fee + latency * latencyCost
+// and filled in order against displayed size. Children go to each venue's
+// sender queue; displayed size is drawn down locally until the next quote.
+class SmartOrderRouter {
+public:
+    static constexpr size_t MAX_VENUES = 16;
+    using VenueQueue = spscqueue::SPSCQueue<Order>;
+
+    SmartOrderRouter(size_t maxInstruments, double latencyCostPerTick);
+
+    // Returns the venue id; the queue is caller-owned and must outlive the router
+    uint8_t addVenue(const VenueConfig& config, VenueQueue* queue);
+
+    void onQuote(uint8_t venue, uint32_t instrumentId, const VenueQuote& quote);
+    void onAck(uint8_t venue, uint64_t latencyTicks);
+
+    // Needs order.instrument_id; children are stamped with nowTick in nanoseconds
+    RouteResult route(const Order& order, uint64_t nowTick);
+
+    [[nodiscard]] size_t venueCount() const;
+    [[nodiscard]] const VenueQuote& quote(uint8_t venue, uint32_t instrumentId) const;
+    [[nodiscard]] uint64_t latencyEstimate(uint8_t venue) const;
+
+private:
+    struct Venue {
+        VenueQueue* queue = nullptr;
+        double feePerShare = 0.0;
+        uint64_t latencyEwma = 0;   // ticks << EWMA_SHIFT
+    };
+
+    static constexpr unsigned EWMA_SHIFT = 3;  // alpha = 1/8
+
+    bool send(uint8_t venue, const Order& parent, double price, uint32_t quantity, uint64_t nowNs);
+
+    std::vector<VenueQuote> quotes_;    // instrument * MAX_VENUES + venue
+    Venue venues_[MAX_VENUES];
+    size_t venueCount_ = 0;
+    size_t maxInstruments_;
+    double latencyCostPerTick_;
+};
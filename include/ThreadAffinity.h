@@ -0,0 +1,23 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+struct CpuInfo {
+    unsigned cpu = 0;
+    int core = -1;      // physical core id within the package, -1 if unknown
+    int package = -1;   // socket id, -1 if unknown
+};
+
+// CPU pinning for benchmark and engine threads
+class ThreadAffinity {
+public:
+    // Binds the calling thread to one logical CPU; false if the OS refuses
+    static bool pinCurrentThread(unsigned cpu);
+
+    // Logical CPUs this process may run on, ascending
+    static std::vector<unsigned> allowedCpus();
+
+    // allowedCpus() with core and package ids, to tell SMT siblings from
+    // separate cores and sockets
+    static std::vector<CpuInfo> topology();
+};
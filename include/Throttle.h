@@ -0,0 +1,53 @@
+#pragma once
+#include <Order.h>
+#include <Clock.h>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+struct ThrottleConfig {
+    uint64_t ticksPerSecond = EngineClock::ticksPerSecond();
+    double sessionRate = 100'000.0;             // tokens per second
+    double sessionBurst = 1'000.0;              // bucket depth, in tokens
+    double accountRate = 250'000.0;
+    double accountBurst = 2'500.0;
+    std::array<uint32_t, 3> typeCost{1, 1, 1};  // tokens per message, indexed by OrderType
+};
+
+// One cache line per bucket. Tokens are fixed point (TOKEN_ONE = one token)
+// and refilled lazily from the clock delta on each admit; no timers.
+struct alignas(64) TokenBucket {
+    static constexpr uint64_t TOKEN_ONE = uint64_t(1) << 32;
+
+    uint64_t tokens = 0;
+    uint64_t capacity = 0;
+    uint64_t refillPerTick = 0;
+    uint64_t lastTick = 0;
+    uint64_t blockedUntil = 0;  // while now < blockedUntil, rejects skip all refill math
+    uint64_t accepted = 0;
+    uint64_t rejected = 0;
+};
+
+static_assert(sizeof(TokenBucket) == 64, "TokenBucket must fill exactly one cache line");
+
+// Per-session and per-account message rate limiter, applied before parse.
+// A message is admitted only when both its session and account buckets hold
+// enough tokens; rejecting a blocked sender costs one compare.
+class Throttle {
+public:
+    Throttle(const ThrottleConfig& config, size_t sessions, size_t accounts);
+
+    bool admit(uint32_t sessionId, uint32_t accountId, OrderType type, uint64_t nowTick = EngineClock::now());
+
+    // Reads only the type byte of a raw WireOrder, so no parse work is spent on rejects
+    bool admitRaw(uint32_t sessionId, uint32_t accountId, const uint8_t* data, size_t size, uint64_t nowTick = EngineClock::now());
+
+    [[nodiscard]] const TokenBucket& session(uint32_t sessionId) const;
+    [[nodiscard]] const TokenBucket& account(uint32_t accountId) const;
+
+private:
+    std::vector<TokenBucket> sessions_;
+    std::vector<TokenBucket> accounts_;
+    std::array<uint64_t, 3> typeCost_;
+};
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+// Intrusive timer: embed in the owning (pooled) object; `cookie` identifies
+// the owner in the expiry callback. The wheel never allocates.
+struct TimerNode {
+    TimerNode* next = nullptr;
+    TimerNode* prev = nullptr;
+    uint64_t expiry = 0;
+    uint64_t cookie = 0;
+    uint16_t slot = 0;
+    uint8_t level = 0;
+    bool linked = false;
+};
+
+// Hierarchical hashed timer wheel: 4 levels of 256 slots cover 2^32 ticks,
+// later timers wait on an overflow list. schedule/cancel are O(1); poll
+// cascades a slot down a level when the level below wraps, skips empty
+// stretches, and fires every expired timer in one batch. Ticks are whatever
+// the caller drives it with (e.g. EngineClock::now() >> shift).
+class TimerWheel {
+public:
+    static constexpr size_t LEVELS = 4;
+    static constexpr size_t SLOT_BITS = 8;
+    static constexpr size_t SLOTS = size_t(1) << SLOT_BITS;
+
+    explicit TimerWheel(uint64_t startTick = 0);
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // Expiries in the past fire on the next poll; rescheduling a linked node moves it
+    void schedule(TimerNode* node, uint64_t expiryTick);
+    void cancel(TimerNode* node);
+
+    // Fires onExpire(TimerNode*) for every timer with expiry <= nowTick; the
+    // node is already unlinked, so the callback may reschedule it
+    template <typename F>
+    size_t poll(uint64_t nowTick, F&& onExpire);
+
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] uint64_t currentTick() const;
+
+private:
+    struct Slot {
+        TimerNode* head = nullptr;
+    };
+
+    void link(TimerNode* node, Slot& slot);
+    Slot& slotOf(const TimerNode* node);
+    void place(TimerNode* node);
+    void cascade();
+    uint64_t nextBoundary() const;
+
+    Slot levels_[LEVELS][SLOTS];
+    Slot overflow_;
+    size_t levelCount_[LEVELS + 1]{};   // last entry counts the overflow list
+    uint64_t current_;                  // next tick to be processed
+    size_t size_ = 0;
+};
+
+template <typename F>
+size_t TimerWheel::poll(uint64_t nowTick, F&& onExpire) {
+    size_t fired = 0;
+    while (current_ <= nowTick) {
+        if ((current_ & (SLOTS - 1)) == 0) cascade();
+
+        if (levelCount_[0] == 0) {
+            // Nothing can fire before the next boundary with work on it
+            uint64_t next = nextBoundary();
+            if (next > nowTick) {
+                current_ = nowTick + 1;
+                break;
+            }
+            current_ = next;
+            continue;
+        }
+
+        Slot& slot = levels_[0][current_ & (SLOTS - 1)];
+        TimerNode* node = slot.head;
+        slot.head = nullptr;
+        // Anything scheduled from a callback lands on the next tick at the earliest
+        ++current_;
+        while (node) {
+            TimerNode* next = node->next;
+            node->next = node->prev = nullptr;
+            node->linked = false;
+            --levelCount_[0];
+            --size_;
+            ++fired;
+            onExpire(node);
+            node = next;
+        }
+    }
+    return fired;
+}
@@ -28,3 +28,33 @@ struct WireOrder {
 #pragma pack(pop)
 
 static_assert(sizeof(WireOrder) == 38, "WireOrder must be exactly 38 bytes");
+
+// Internal-link layout: fields reordered and padded to 40 bytes so each one
+// is naturally aligned and consecutive messages never split a cache line
+// mid-field. Same big-endian encoding as WireOrder.
+struct alignas(8) AlignedWireOrder {
+    uint64_t order_id;
+    uint64_t timestamp_ns;
+    uint64_t price;
+    char symbol[8];
+    uint32_t quantity;
+    Side side;
+    OrderType type;
+    uint8_t _padding[2];
+};
+
+static_assert(sizeof(AlignedWireOrder) == 40, "AlignedWireOrder must be exactly 40 bytes");
+
+// Byte-order helpers shared by the wire codecs
+namespace wire {
+uint64_t hton64(uint64_t value);
+uint64_t ntoh64(uint64_t value);
+uint64_t doubleToUint64(double value);
+double uint64ToDouble(uint64_t value);
+} // namespace wire
+
+// Wire layout used on a given link
+enum struct WireFormat : uint8_t {
+    Packed = 0,     // WireOrder, 38 bytes
+    Aligned = 1     // AlignedWireOrder, 40 bytes
+};
@@ -0,0 +1,55 @@
+#pragma once
+#include <templates/spsc_queue/SPSCQueue.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace conflatingqueue {
+
+// Single-producer / single-consumer conflating queue keyed by instrument id.
+// The producer overwrites the instrument's slot (seqlock) and enqueues the id
+// only when the slot was clean, so a slow consumer reads the latest state once
+// per instrument and memory stays at maxKeys slots however far behind it is.
+template <typename T>
+class ConflatingQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "ConflatingQueue values are copied under a seqlock");
+
+public:
+    explicit ConflatingQueue(size_t maxKeys);
+
+    ConflatingQueue(const ConflatingQueue&) = delete;
+    ConflatingQueue& operator=(const ConflatingQueue&) = delete;
+
+    // Producer: false only for an out-of-range key
+    bool publish(uint32_t key, const T& value);
+
+    // Consumer: latest value for the next dirty key
+    bool pop(uint32_t& key, T& value);
+
+    [[nodiscard]] size_t pending() const;
+    [[nodiscard]] size_t capacity() const;
+    [[nodiscard]] uint64_t published() const;
+    [[nodiscard]] uint64_t conflated() const;   // updates merged into a pending slot
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<uint32_t> seq{0};
+        std::atomic<bool> dirty{false};
+        T value{};
+    };
+
+    static size_t queueCapacity(size_t maxKeys);
+
+    std::vector<Slot> slots_;
+    spscqueue::SPSCQueue<uint32_t> ready_;      // holds each dirty key once, so never full
+    uint64_t published_ = 0;
+    uint64_t conflated_ = 0;
+};
+
+#include "ConflatingQueue.tpp"
+
+} // namespace conflatingqueue
@@ -0,0 +1,73 @@
+#pragma once
+#include "ConflatingQueue.h"
+
+    template <typename T>
+    size_t ConflatingQueue<T>::queueCapacity(size_t maxKeys) {
+        if (maxKeys == 0 || maxKeys >= UINT32_MAX)
+            throw std::invalid_argument("ConflatingQueue needs 0 < maxKeys < 2^32 - 1");
+        size_t capacity = 2;
+        while (capacity < maxKeys + 1) capacity <<= 1;   // ring keeps one slot empty
+        return capacity;
+    }
+
+    template <typename T>
+    ConflatingQueue<T>::ConflatingQueue(size_t maxKeys)
+        : slots_(maxKeys), ready_(queueCapacity(maxKeys)) {}
+
+    template <typename T>
+    bool ConflatingQueue<T>::publish(uint32_t key, const T& value) {
+        if (key >= slots_.size()) return false;
+        Slot& slot = slots_[key];
+
+        uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+        slot.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&slot.value, &value, sizeof(T));
+        slot.seq.store(seq + 2, std::memory_order_release);
+
+        ++published_;
+        // Pairs with the consumer's exchange: whoever sees the slot clean owns the enqueue.
+        // A key is re-queued only after the consumer has popped it and cleared the flag,
+        // so ready_ holds each key at most once and the push cannot fail
+        if (slot.dirty.exchange(true, std::memory_order_acq_rel)) ++conflated_;
+        else ready_.push(key);
+        return true;
+    }
+
+    template <typename T>
+    bool ConflatingQueue<T>::pop(uint32_t& key, T& value) {
+        if (!ready_.pop(key)) return false;
+        Slot& slot = slots_[key];
+
+        // Clear before reading: a write that races the read re-enqueues the key,
+        // so the consumer may see a value twice but never misses the latest one
+        slot.dirty.exchange(false, std::memory_order_acq_rel);
+        uint32_t before, after;
+        do {
+            before = slot.seq.load(std::memory_order_acquire);
+            std::memcpy(&value, &slot.value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = slot.seq.load(std::memory_order_relaxed);
+        } while ((before & 1) || before != after);
+        return true;
+    }
+
+    template <typename T>
+    size_t ConflatingQueue<T>::pending() const {
+        return ready_.size();
+    }
+
+    template <typename T>
+    size_t ConflatingQueue<T>::capacity() const {
+        return slots_.size();
+    }
+
+    template <typename T>
+    uint64_t ConflatingQueue<T>::published() const {
+        return published_;
+    }
+
+    template <typename T>
+    uint64_t ConflatingQueue<T>::conflated() const {
+        return conflated_;
+    }
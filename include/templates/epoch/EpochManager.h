@@ -0,0 +1,85 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace epoch {
+
+// Epoch-based reclamation for read-mostly shared data (symbol tables, limit
+// tables, routing maps). Readers announce the global epoch in their own
+// cache-line slot; writers unlink an object, retire it, and it is freed once
+// every online reader has announced an epoch past the retirement.
+//
+// Two reader styles share the same slots:
+//   - quiescent(): the thread stays online and reports, between batches, that
+//     it holds no shared pointers. One acquire load + one release store.
+//   - enter()/exit(): the thread is offline outside its critical section, so
+//     an idle thread never holds back reclamation. enter() needs a full fence.
+template <size_t MaxThreads = 64>
+class EpochManager {
+public:
+    EpochManager();
+    ~EpochManager();
+
+    EpochManager(const EpochManager&) = delete;
+    EpochManager& operator=(const EpochManager&) = delete;
+    EpochManager(EpochManager&&) = delete;
+    EpochManager& operator=(EpochManager&&) = delete;
+
+    // Reader side
+    size_t registerThread();            // slot starts online at the current epoch
+    void unregisterThread(size_t tid);  // frees the slot for the next registerThread
+    void quiescent(size_t tid);
+    void enter(size_t tid);
+    void exit(size_t tid);
+
+    // Writer side: `ptr` must already be unreachable for new readers
+    template <typename T>
+    void retire(T* ptr);
+    void retire(void* ptr, void (*deleter)(void*));
+
+    size_t reclaim();
+    void startReclaimer(std::chrono::microseconds period);
+    void stopReclaimer();
+
+    [[nodiscard]] uint64_t epoch() const;
+    [[nodiscard]] size_t pending() const;
+
+private:
+    static constexpr uint64_t OFFLINE = UINT64_MAX;
+
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> epoch{OFFLINE};
+        bool used = false;      // guarded by retireMutex_; OFFLINE alone may be an enter/exit reader
+    };
+
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+        uint64_t safeEpoch;     // freeable once every online reader has announced this
+    };
+
+    uint64_t oldestAnnounced() const;
+
+    alignas(64) std::atomic<uint64_t> epoch_{1};
+    Slot slots_[MaxThreads];
+    std::atomic<size_t> threadCount_{0};    // slots ever handed out; freed ones below it are reused
+
+    mutable std::mutex retireMutex_;
+    std::vector<Retired> retired_;
+
+    std::thread reclaimer_;
+    std::mutex reclaimerMutex_;
+    std::condition_variable reclaimerWake_;
+    bool reclaimerStop_ = false;
+};
+
+#include "EpochManager.tpp" // include template implementation
+
+} // namespace epoch
@@ -0,0 +1,135 @@
+#pragma once
+#include "EpochManager.h"
+
+    template <size_t MaxThreads>
+    EpochManager<MaxThreads>::EpochManager() = default;
+
+    template <size_t MaxThreads>
+    EpochManager<MaxThreads>::~EpochManager() {
+        stopReclaimer();
+        // No readers may be active by now
+        for (const Retired& r : retired_)
+            r.deleter(r.ptr);
+    }
+
+    // Reuses the lowest slot an unregistered thread left behind, so only
+    // threads alive at the same time count against MaxThreads
+    template <size_t MaxThreads>
+    size_t EpochManager<MaxThreads>::registerThread() {
+        std::lock_guard<std::mutex> lock(retireMutex_);
+        size_t count = threadCount_.load(std::memory_order_relaxed);
+        size_t tid = 0;
+        while (tid < count && slots_[tid].used) ++tid;
+        if (tid == MaxThreads)
+            throw std::length_error("EpochManager thread slots exhausted");
+        slots_[tid].used = true;
+        slots_[tid].epoch.store(epoch_.load(std::memory_order_acquire), std::memory_order_seq_cst);
+        if (tid == count) threadCount_.store(count + 1, std::memory_order_release);
+        return tid;
+    }
+
+    template <size_t MaxThreads>
+    void EpochManager<MaxThreads>::unregisterThread(size_t tid) {
+        slots_[tid].epoch.store(OFFLINE, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(retireMutex_);
+        slots_[tid].used = false;
+    }
+
+    // Online threads only ever raise their announcement, so a reclaimer that
+    // sees a stale (older) value is merely conservative: no fence needed
+    template <size_t MaxThreads>
+    void EpochManager<MaxThreads>::quiescent(size_t tid) {
+        slots_[tid].epoch.store(epoch_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    // Coming from OFFLINE the announcement must be visible before any shared
+    // pointer is read, hence the seq_cst store (one locked instruction on x86)
+    template <size_t MaxThreads>
+    void EpochManager<MaxThreads>::enter(size_t tid) {
+        slots_[tid].epoch.store(epoch_.load(std::memory_order_acquire), std::memory_order_seq_cst);
+    }
+
+    template <size_t MaxThreads>
+    void EpochManager<MaxThreads>::exit(size_t tid) {
+        slots_[tid].epoch.store(OFFLINE, std::memory_order_release);
+    }
+
+    template <size_t MaxThreads>
+    template <typename T>
+    void EpochManager<MaxThreads>::retire(T* ptr) {
+        retire(static_cast<void*>(ptr), [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    template <size_t MaxThreads>
+    void EpochManager<MaxThreads>::retire(void* ptr, void (*deleter)(void*)) {
+        // Readers announcing the new epoch loaded it after the unlink, so cannot hold ptr
+        uint64_t safe = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+        std::lock_guard<std::mutex> lock(retireMutex_);
+        retired_.push_back(Retired{ptr, deleter, safe});
+    }
+
+    template <size_t MaxThreads>
+    uint64_t EpochManager<MaxThreads>::oldestAnnounced() const {
+        uint64_t oldest = OFFLINE;
+        size_t threads = threadCount_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < threads; ++i) {
+            uint64_t e = slots_[i].epoch.load(std::memory_order_acquire);
+            oldest = e < oldest ? e : oldest;
+        }
+        return oldest;
+    }
+
+    template <size_t MaxThreads>
+    size_t EpochManager<MaxThreads>::reclaim() {
+        std::vector<Retired> ready;
+        {
+            std::lock_guard<std::mutex> lock(retireMutex_);
+            uint64_t oldest = oldestAnnounced();
+            size_t kept = 0;
+            for (const Retired& r : retired_) {
+                if (r.safeEpoch <= oldest) ready.push_back(r);
+                else retired_[kept++] = r;
+            }
+            retired_.resize(kept);
+        }
+        // Deleters run outside the lock so retire() is never blocked on them
+        for (const Retired& r : ready)
+            r.deleter(r.ptr);
+        return ready.size();
+    }
+
+    template <size_t MaxThreads>
+    void EpochManager<MaxThreads>::startReclaimer(std::chrono::microseconds period) {
+        stopReclaimer();
+        reclaimerStop_ = false;
+        reclaimer_ = std::thread([this, period] {
+            std::unique_lock<std::mutex> lock(reclaimerMutex_);
+            while (!reclaimerWake_.wait_for(lock, period, [this] { return reclaimerStop_; })) {
+                lock.unlock();
+                reclaim();
+                lock.lock();
+            }
+        });
+    }
+
+    template <size_t MaxThreads>
+    void EpochManager<MaxThreads>::stopReclaimer() {
+        if (!reclaimer_.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(reclaimerMutex_);
+            reclaimerStop_ = true;
+        }
+        reclaimerWake_.notify_all();
+        reclaimer_.join();
+    }
+
+    template <size_t MaxThreads>
+    uint64_t EpochManager<MaxThreads>::epoch() const {
+        return epoch_.load(std::memory_order_acquire);
+    }
+
+    template <size_t MaxThreads>
+    size_t EpochManager<MaxThreads>::pending() const {
+        std::lock_guard<std::mutex> lock(retireMutex_);
+        return retired_.size();
+    }
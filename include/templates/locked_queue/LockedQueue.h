@@ -0,0 +1,42 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+
+namespace lockedqueue {
+
+enum struct WaitPolicy {
+    CondVar,    // popWait sleeps on a condition variable, push notifies
+    Spin        // popWait polls the mutex-protected queue
+};
+
+// Mutex-protected std::queue with the SPSCQueue push/pop interface; the
+// baseline SPSCQueue handoff latency is measured against
+template <typename T, WaitPolicy Wait>
+class LockedQueue {
+public:
+    explicit LockedQueue(size_t capacity);
+
+    LockedQueue(const LockedQueue&) = delete;
+    LockedQueue& operator=(const LockedQueue&) = delete;
+
+    bool push(const T& item);   // false at capacity
+    bool pop(T& item);          // non-blocking
+    void popWait(T& item);
+
+    [[nodiscard]] bool empty() const;
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] size_t capacity() const;
+
+private:
+    const size_t capacity_;
+    std::queue<T> queue_;
+    mutable std::mutex mutex_;
+    std::condition_variable ready_;
+};
+
+#include "LockedQueue.tpp"
+
+} // namespace lockedqueue
@@ -0,0 +1,56 @@
+#pragma once
+#include "LockedQueue.h"
+
+    template <typename T, WaitPolicy Wait>
+    LockedQueue<T, Wait>::LockedQueue(size_t capacity) : capacity_(capacity) {
+        if (capacity == 0) throw std::invalid_argument("Capacity must be > 0");
+    }
+
+    template <typename T, WaitPolicy Wait>
+    bool LockedQueue<T, Wait>::push(const T& item) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (queue_.size() == capacity_) return false;
+            queue_.push(item);
+        }
+        if constexpr (Wait == WaitPolicy::CondVar) ready_.notify_one();
+        return true;
+    }
+
+    template <typename T, WaitPolicy Wait>
+    bool LockedQueue<T, Wait>::pop(T& item) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) return false;
+        item = queue_.front();
+        queue_.pop();
+        return true;
+    }
+
+    template <typename T, WaitPolicy Wait>
+    void LockedQueue<T, Wait>::popWait(T& item) {
+        if constexpr (Wait == WaitPolicy::CondVar) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ready_.wait(lock, [this] { return !queue_.empty(); });
+            item = queue_.front();
+            queue_.pop();
+        } else {
+            while (!pop(item)) {}
+        }
+    }
+
+    template <typename T, WaitPolicy Wait>
+    bool LockedQueue<T, Wait>::empty() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.empty();
+    }
+
+    template <typename T, WaitPolicy Wait>
+    size_t LockedQueue<T, Wait>::size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+    }
+
+    template <typename T, WaitPolicy Wait>
+    size_t LockedQueue<T, Wait>::capacity() const {
+        return capacity_;
+    }
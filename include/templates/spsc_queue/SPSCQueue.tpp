@@ -5,7 +5,7 @@
     SPSCQueue<T>::SPSCQueue(size_t capacity) : capacity_(capacity), head_(0), tail_(0) {
         if (capacity < 2 || (capacity & (capacity - 1)) != 0)
             throw std::invalid_argument("Capacity must be >= 2 and a power of 2");
-        buffer_ = static_cast<T*>(operator new[](capacity_ * sizeof(T)));
+        buffer_ = static_cast<T*>(operator new[](capacity_ * sizeof(T), std::align_val_t(alignof(T))));
     }
 
     template <typename T>
@@ -16,7 +16,7 @@
             buffer_[t].~T();
             t = (t + 1) & (capacity_ - 1);
         }
-        operator delete[](buffer_);
+        operator delete[](buffer_, std::align_val_t(alignof(T)));
     }
 
     template <typename T>
@@ -0,0 +1,173 @@
+#include <AlgoScheduler.h>
+#include <OrderIdGenerator.h>
+#include <Clock.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+AlgoScheduler::AlgoScheduler(size_t maxAlgos, size_t maxInstruments, uint64_t ticksPerSlot, uint64_t nowTick,
+                             ChildSink sink)
+    : algos_(maxAlgos), instrumentHead_(maxInstruments, NONE),
+      ticksPerSlot_(ticksPerSlot), sink_(std::move(sink)),
+      wheel_(ticksPerSlot ? nowTick / ticksPerSlot : 0) {
+    if (maxAlgos == 0 || maxAlgos >= NONE || ticksPerSlot == 0)
+        throw std::invalid_argument("AlgoScheduler needs 0 < maxAlgos < 2^32 - 1 and ticksPerSlot > 0");
+    freeList_.reserve(maxAlgos);
+    for (size_t i = maxAlgos; i > 0; --i)
+        freeList_.push_back(static_cast<uint32_t>(i - 1));
+}
+
+std::optional<AlgoScheduler::Handle> AlgoScheduler::submit(const ParentOrderSpec& spec) {
+    if (freeList_.empty() || spec.quantity == 0 || spec.endTick < spec.startTick) return std::nullopt;
+    if (spec.algo == AlgoType::POV && (spec.instrumentId >= instrumentHead_.size() || spec.participation <= 0.0))
+        return std::nullopt;
+    if (spec.algo == AlgoType::VWAP && (!spec.profile || spec.profile->size() != spec.slices))
+        return std::nullopt;
+    if (spec.algo != AlgoType::POV && spec.slices == 0) return std::nullopt;
+
+    // Slice targets are profileDone / profileTotal: a negative weight would
+    // pull the target back and a zero total would divide by zero
+    double profileTotal = 0.0;
+    if (spec.algo == AlgoType::VWAP) {
+        for (double w : *spec.profile) {
+            if (!(w >= 0.0)) return std::nullopt;
+            profileTotal += w;
+        }
+        if (!(profileTotal > 0.0)) return std::nullopt;
+    }
+
+    uint32_t index = freeList_.back();
+    freeList_.pop_back();
+
+    AlgoState& algo = algos_[index];
+    algo = AlgoState{};
+    algo.spec = spec;
+    algo.timer.cookie = index;
+    algo.active = true;
+    algo.profileTotal = profileTotal;
+    ++activeCount_;
+
+    if (spec.algo == AlgoType::POV) {
+        linkInstrument(index);
+        schedule(index, spec.endTick); // expiry
+    } else {
+        schedule(index, sliceTick(algo, 0));
+    }
+    return index;
+}
+
+void AlgoScheduler::cancel(Handle handle) {
+    if (handle < algos_.size() && algos_[handle].active) finish(handle);
+}
+
+// Slice k fires at the start of its interval; the last one at or before endTick
+uint64_t AlgoScheduler::sliceTick(const AlgoState& algo, uint32_t slice) const {
+    const ParentOrderSpec& s = algo.spec;
+    return s.startTick + (s.endTick - s.startTick) * slice / s.slices;
+}
+
+void AlgoScheduler::onTimer(uint64_t nowTick) {
+    wheel_.poll(nowTick / ticksPerSlot_, [&](TimerNode* node) {
+        fire(static_cast<uint32_t>(node->cookie), nowTick);
+    });
+}
+
+void AlgoScheduler::onMarketData(uint32_t instrumentId, uint64_t tradedVolume, uint64_t nowTick) {
+    if (instrumentId >= instrumentHead_.size()) return;
+    uint32_t index = instrumentHead_[instrumentId];
+    while (index != NONE) {
+        AlgoState& algo = algos_[index];
+        uint32_t next = algo.mdNext;
+        if (nowTick >= algo.spec.startTick) {
+            algo.marketVolume += tradedVolume;
+            uint64_t target = std::min<uint64_t>(
+                static_cast<uint64_t>(algo.marketVolume * algo.spec.participation), algo.spec.quantity);
+            if (target >= uint64_t(algo.sent) + algo.spec.minClip || target == algo.spec.quantity)
+                emit(algo, static_cast<uint32_t>(target - algo.sent), nowTick);
+            if (algo.sent == algo.spec.quantity) finish(index);
+        }
+        index = next;
+    }
+}
+
+void AlgoScheduler::fire(uint32_t index, uint64_t nowTick) {
+    AlgoState& algo = algos_[index];
+    const ParentOrderSpec& s = algo.spec;
+
+    if (s.algo == AlgoType::POV) { // end of the participation window
+        finish(index);
+        return;
+    }
+
+    uint32_t slice = algo.nextSlice++;
+    uint64_t target;
+    if (algo.nextSlice == s.slices) {
+        target = s.quantity;
+    } else if (s.algo == AlgoType::VWAP) {
+        algo.profileDone += (*s.profile)[slice];
+        target = static_cast<uint64_t>(s.quantity * (algo.profileDone / algo.profileTotal));
+    } else {
+        target = uint64_t(s.quantity) * algo.nextSlice / s.slices;
+    }
+    if (target > algo.sent) emit(algo, static_cast<uint32_t>(target - algo.sent), nowTick);
+
+    if (algo.nextSlice == s.slices) finish(index);
+    else schedule(index, sliceTick(algo, algo.nextSlice));
+}
+
+void AlgoScheduler::emit(AlgoState& algo, uint32_t quantity, uint64_t nowTick) {
+    if (quantity == 0) return;
+    const ParentOrderSpec& s = algo.spec;
+    const uint64_t nowNs = static_cast<uint64_t>(ticksToNanos(nowTick));
+    Order child(OrderIdGenerator::local().next(), nowNs, s.symbol, s.limitPrice, quantity, s.side, OrderType::Limit);
+    child.instrument_id = s.instrumentId;
+    algo.sent += quantity;
+    sink_(child);
+}
+
+void AlgoScheduler::finish(uint32_t index) {
+    AlgoState& algo = algos_[index];
+    unschedule(index);
+    if (algo.spec.algo == AlgoType::POV) unlinkInstrument(index);
+    algo.active = false;
+    --activeCount_;
+    freeList_.push_back(index);
+}
+
+void AlgoScheduler::schedule(uint32_t index, uint64_t dueTick) {
+    wheel_.schedule(&algos_[index].timer, dueTick / ticksPerSlot_);
+}
+
+void AlgoScheduler::unschedule(uint32_t index) {
+    wheel_.cancel(&algos_[index].timer);
+}
+
+void AlgoScheduler::linkInstrument(uint32_t index) {
+    AlgoState& algo = algos_[index];
+    uint32_t& head = instrumentHead_[algo.spec.instrumentId];
+    algo.mdPrev = NONE;
+    algo.mdNext = head;
+    if (head != NONE) algos_[head].mdPrev = index;
+    head = index;
+}
+
+void AlgoScheduler::unlinkInstrument(uint32_t index) {
+    AlgoState& algo = algos_[index];
+    uint32_t& head = instrumentHead_[algo.spec.instrumentId];
+    if (algo.mdPrev != NONE) algos_[algo.mdPrev].mdNext = algo.mdNext;
+    else head = algo.mdNext;
+    if (algo.mdNext != NONE) algos_[algo.mdNext].mdPrev = algo.mdPrev;
+    algo.mdNext = algo.mdPrev = NONE;
+}
+
+bool AlgoScheduler::active(Handle handle) const {
+    return handle < algos_.size() && algos_[handle].active;
+}
+
+uint32_t AlgoScheduler::sent(Handle handle) const {
+    return handle < algos_.size() ? algos_[handle].sent : 0;
+}
+
+size_t AlgoScheduler::activeCount() const {
+    return activeCount_;
+}
@@ -0,0 +1,136 @@
+#include <Modes.h>
+#include <ModeSupport.h>
+#include <Clock.h>
+#include <MessageParser.h>
+#include <LatencyTracker.h>
+#include <Corpus.h>
+#include <ThreadAffinity.h>
+#include <algorithm>
+#include <iostream>
+
+// Times only parsing over a mapped, prefaulted corpus: once message by
+// message, once through parseBatch, each feeding the selected sink. With
+// --dedup and/or --risk a third pass runs those stages after each parse.
+int benchCorpus(int argc, char** argv) {
+    std::vector<std::string> args(argv, argv + argc);
+    auto sinkKind = takeSinkOption(args);
+    StageOptions stages;
+    RecordOptions record;
+    if (!sinkKind || !takeStageOptions(args, stages) || !takeRecordOptions(args, record) || args.empty()) {
+        std::cerr << "Usage: bench <corpus> [--sink discard|ring|queue] [--dedup] [--risk] [--secmaster <file>] [--record <file>] [--repeat <n>]\n";
+        return 1;
+    }
+
+    try {
+        Corpus corpus(args[0]);
+        const uint8_t* data = corpus.messages();
+        const size_t size = corpus.messageSize();
+        const uint64_t count = corpus.count();
+        const std::string source = args[0].substr(args[0].find_last_of("/\\") + 1);
+
+        const SecurityMaster* master = loadSecurityMaster(stages);
+        if (!tuningAllows({ThreadAffinity::allowedCpus()[0]})) return 1;
+
+        MessageParser parser;
+        parser.setSecurityMaster(master);
+        LatencyTracker benchmarker;
+        PerfCounters counters;
+
+        std::cout << "=== Corpus: " << args[0] << " (" << count << " messages, sink "
+                  << sinkName(*sinkKind) << (master ? ", security master " + stages.secmasterPath : "") << ") ===\n";
+
+        for (size_t run = 0; run < record.repeat; ++run) {
+            if (record.repeat > 1) std::cout << "--- run " << run + 1 << "/" << record.repeat << " ---\n";
+            MessageParser::resetLatency();
+            double parseSeconds = 0.0;
+
+            withSink(*sinkKind, [&](auto& sink) {
+                counters.start();
+                uint64_t start = EngineClock::now();
+                for (uint64_t i = 0; i < count; ++i) {
+                    auto parsedOrder = parser.parse(data + i * size, size);
+                    if (parsedOrder) sink.consume(*parsedOrder);
+                }
+                sink.finish();
+                double seconds = ticksToNanos(EngineClock::now() - start) / 1e9;
+                PerfReading reading = counters.stop();
+                parseSeconds = seconds;
+                std::cout << "parse:      " << seconds << " s, " << perSecond(count, seconds) << " messages/sec"
+                          << " (accepted " << sink.count() << ", checksum " << sink.checksum() << ")\n";
+                printCounters(reading, count);
+
+                BenchmarkRecord result = BenchmarkRecord::make("bench/parse/" + source + "/" + sinkName(*sinkKind), count);
+                result.addParseStats(seconds, parser.getTimestampList(),
+                                     std::min<uint64_t>(parser.getIndex(), MessageParser::MAX_SAMPLES));
+                result.addCounters(reading);
+                saveRecord(record, result);
+            });
+            uint64_t samples = std::min<uint64_t>(parser.getIndex(), MessageParser::MAX_SAMPLES);
+
+            withSink(*sinkKind, [&](auto& sink) {
+                constexpr size_t BATCH = 64;
+                Order out[BATCH];
+                counters.start();
+                uint64_t start = EngineClock::now();
+                for (uint64_t i = 0; i < count; i += BATCH) {
+                    size_t n = static_cast<size_t>(std::min<uint64_t>(BATCH, count - i));
+                    size_t ok = parser.parseBatch(data + i * size, n, size, out);
+                    for (size_t j = 0; j < ok; ++j) sink.consume(out[j]);
+                }
+                sink.finish();
+                double seconds = ticksToNanos(EngineClock::now() - start) / 1e9;
+                PerfReading reading = counters.stop();
+                std::cout << "parseBatch: " << seconds << " s, " << perSecond(count, seconds) << " messages/sec"
+                          << " (accepted " << sink.count() << ", checksum " << sink.checksum() << ")\n";
+                printCounters(reading, count);
+
+                BenchmarkRecord result = BenchmarkRecord::make("bench/parseBatch/" + source + "/" + sinkName(*sinkKind), count);
+                result.addParseStats(seconds, nullptr, 0);
+                result.addCounters(reading);
+                saveRecord(record, result);
+            });
+
+            std::cout << "Per-message parse latency:\n";
+            benchmarker.analyzeLatencies(parser.getTimestampList(), samples);
+
+            // After the latency report, since these parses record samples too
+            if (stages.dedup || stages.risk) withSink(*sinkKind, [&](auto& sink) {
+                const std::string label = std::string("parse") + (stages.dedup ? "+dedup" : "") + (stages.risk ? "+risk" : "");
+                RiskLimits limits = benchRiskLimits(master);
+                RiskChecker checker(limits);
+                std::optional<DuplicateDetector> dedup;
+                if (stages.dedup) dedup.emplace(benchDuplicateDetector(count));
+                counters.start();
+                uint64_t start = EngineClock::now();
+                for (uint64_t i = 0; i < count; ++i) {
+                    auto parsedOrder = parser.parse(data + i * size, size);
+                    if (!parsedOrder) continue;
+                    if (dedup && dedup->isDuplicate(parsedOrder->order_id)) continue;
+                    if (stages.risk && !checker.check(*parsedOrder, riskInstrument(*parsedOrder), 0).accepted) {
+                        if (dedup) dedup->onOrderClosed(parsedOrder->order_id);
+                        continue;
+                    }
+                    sink.consume(*parsedOrder);
+                }
+                sink.finish();
+                double seconds = ticksToNanos(EngineClock::now() - start) / 1e9;
+                PerfReading reading = counters.stop();
+                std::cout << label << ": " << seconds << " s, " << perSecond(count, seconds) << " messages/sec, "
+                          << perSecond((seconds - parseSeconds) * 1e9, double(count)) << " ns/message over parse"
+                          << " (accepted " << sink.count() << ", checksum " << sink.checksum() << ")\n";
+                if (dedup) printDuplicateCounters(*dedup);
+                if (stages.risk) printRiskCounters(checker);
+                printCounters(reading, count);
+
+                BenchmarkRecord result = BenchmarkRecord::make("bench/" + label + "/" + source + "/" + sinkName(*sinkKind), count);
+                result.addParseStats(seconds, nullptr, 0);
+                result.addCounters(reading);
+                saveRecord(record, result);
+            });
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
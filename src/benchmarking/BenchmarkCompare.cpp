@@ -0,0 +1,274 @@
+#include <BenchmarkCompare.h>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+struct SplitMix64 {
+    uint64_t state;
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+};
+
+// Linear interpolation between closest ranks; reorders `v`
+double quantile(std::vector<double>& v, double q) {
+    if (v.empty()) return 0.0;
+    double h = (v.size() - 1) * q;
+    size_t lo = static_cast<size_t>(h);
+    std::nth_element(v.begin(), v.begin() + lo, v.end());
+    double low = v[lo];
+    if (lo + 1 >= v.size()) return low;
+    double high = *std::min_element(v.begin() + lo + 1, v.end());
+    return low + (high - low) * (h - lo);
+}
+
+double quantileOf(std::vector<double> v, double q) { return quantile(v, q); }
+
+// Two-sided p from the exact null distribution of U for tie-free samples:
+// the largest remaining value comes from `a` (beating all n of `b`) or from `b`
+double exactPValue(size_t m, size_t n, double u) {
+    std::vector<std::vector<std::vector<double>>> count(m + 1, std::vector<std::vector<double>>(n + 1));
+    for (size_t i = 0; i <= m; ++i) {
+        for (size_t j = 0; j <= n; ++j) {
+            count[i][j].assign(i * j + 1, 0.0);
+            if (i == 0 || j == 0) { count[i][j][0] = 1.0; continue; }
+            for (size_t k = 0; k <= i * j; ++k) {
+                double fromA = k >= j ? (k - j < count[i - 1][j].size() ? count[i - 1][j][k - j] : 0.0) : 0.0;
+                double fromB = k < count[i][j - 1].size() ? count[i][j - 1][k] : 0.0;
+                count[i][j][k] = fromA + fromB;
+            }
+        }
+    }
+    const std::vector<double>& dist = count[m][n];
+    double total = 0.0, below = 0.0, above = 0.0;
+    for (size_t k = 0; k < dist.size(); ++k) {
+        total += dist[k];
+        if (k <= u) below += dist[k];
+        if (k >= u) above += dist[k];
+    }
+    return std::min(1.0, 2.0 * std::min(below, above) / total);
+}
+
+// Smallest two-sided p the exact test can give m against n runs, reached
+// when every run of one side beats every run of the other: 2 / C(m+n, m)
+double minimumPValue(size_t m, size_t n) {
+    double orderings = 1.0;
+    for (size_t k = 1; k <= m; ++k) orderings = orderings * double(n + k) / double(k);
+    return std::min(1.0, 2.0 / orderings);
+}
+
+std::string percent(double change) {
+    std::ostringstream s;
+    s << std::showpos << std::fixed << std::setprecision(1) << change * 100.0 << "%";
+    return s.str();
+}
+
+struct Row {
+    std::string label;
+    double baseline = 0.0;
+    double candidate = 0.0;
+    bool tested = false;
+    double pValue = -1.0;       // < 0 when only the interval decides
+    ConfidenceInterval interval;
+    bool lowerIsBetter = true;
+};
+
+bool isLowerBetter(const std::string& key, bool counter) {
+    return counter || (key.size() > 3 && key.compare(key.size() - 3, 3, "_ns") == 0);
+}
+
+}
+
+MannWhitneyResult BenchmarkCompare::mannWhitney(const std::vector<double>& a, const std::vector<double>& b) {
+    MannWhitneyResult result;
+    const size_t m = a.size(), n = b.size();
+    if (m == 0 || n == 0) return result;
+
+    // Rank the pooled samples, ties sharing their average rank
+    std::vector<std::pair<double, bool>> pooled;
+    pooled.reserve(m + n);
+    for (double x : a) pooled.emplace_back(x, true);
+    for (double x : b) pooled.emplace_back(x, false);
+    std::sort(pooled.begin(), pooled.end(), [](const auto& x, const auto& y) { return x.first < y.first; });
+
+    double rankSumA = 0.0, tieTerm = 0.0;
+    for (size_t i = 0; i < pooled.size();) {
+        size_t j = i;
+        while (j < pooled.size() && pooled[j].first == pooled[i].first) ++j;
+        double rank = (i + 1 + j) / 2.0;
+        for (size_t k = i; k < j; ++k)
+            if (pooled[k].second) rankSumA += rank;
+        double t = double(j - i);
+        tieTerm += t * t * t - t;
+        i = j;
+    }
+
+    result.u = rankSumA - m * (m + 1) / 2.0;
+    if (tieTerm == 0.0 && m <= 20 && n <= 20) {
+        result.exact = true;
+        result.pValue = exactPValue(m, n, result.u);
+        return result;
+    }
+
+    double total = double(m + n);
+    double mean = m * n / 2.0;
+    double variance = m * n / 12.0 * ((total + 1.0) - tieTerm / (total * (total - 1.0)));
+    if (variance <= 0.0) return result;     // every value identical
+    double z = std::max(0.0, std::abs(result.u - mean) - 0.5) / std::sqrt(variance);
+    result.pValue = std::erfc(z / std::sqrt(2.0));
+    return result;
+}
+
+ConfidenceInterval BenchmarkCompare::bootstrapRelativeChange(const std::vector<double>& a, const std::vector<double>& b,
+                                                             double q, double confidence, size_t resamples, uint64_t seed) {
+    ConfidenceInterval interval;
+    if (a.empty() || b.empty() || resamples == 0) return interval;
+
+    SplitMix64 rng{seed};
+    std::vector<double> ra(a.size()), rb(b.size()), changes;
+    changes.reserve(resamples);
+    for (size_t r = 0; r < resamples; ++r) {
+        for (double& x : ra) x = a[rng.next() % a.size()];
+        for (double& x : rb) x = b[rng.next() % b.size()];
+        double qa = quantile(ra, q);
+        if (qa == 0.0) continue;
+        changes.push_back((quantile(rb, q) - qa) / qa);
+    }
+    if (changes.empty()) return interval;
+
+    double tail = (1.0 - confidence) / 2.0;
+    interval.low = quantileOf(changes, tail);
+    interval.high = quantileOf(changes, 1.0 - tail);
+    return interval;
+}
+
+size_t BenchmarkCompare::compare(const std::vector<BenchmarkRecord>& baseline, const std::vector<BenchmarkRecord>& candidate,
+                                 const CompareOptions& options, std::ostream& out) {
+    auto select = [](const std::vector<BenchmarkRecord>& records, const std::string& name) {
+        std::vector<const BenchmarkRecord*> runs;
+        for (const BenchmarkRecord& r : records)
+            if (r.name == name) runs.push_back(&r);
+        return runs;
+    };
+    auto describe = [](const std::vector<const BenchmarkRecord*>& runs) {
+        std::vector<std::string> shas;
+        for (const BenchmarkRecord* r : runs)
+            if (std::find(shas.begin(), shas.end(), r->gitSha) == shas.end()) shas.push_back(r->gitSha);
+        std::string text;
+        for (const std::string& sha : shas) text += (text.empty() ? "" : ",") + sha;
+        return text + " (" + std::to_string(runs.size()) + (runs.size() == 1 ? " run)" : " runs)");
+    };
+
+    std::vector<std::string> names;
+    for (const BenchmarkRecord& r : baseline)
+        if (std::find(names.begin(), names.end(), r.name) == names.end()) names.push_back(r.name);
+
+    size_t regressions = 0;
+    for (const std::string& name : names) {
+        auto a = select(baseline, name);
+        auto b = select(candidate, name);
+        if (b.empty()) {
+            out << "--- " << name << ": no candidate runs\n";
+            continue;
+        }
+        // Too few runs can never reach alpha, however large the change
+        const bool runLevel = minimumPValue(a.size(), b.size()) <= options.alpha;
+
+        out << "\n=== " << name << ": " << describe(a) << " vs " << describe(b) << " ===\n";
+        if (a.front()->clock != b.front()->clock)
+            out << "warning: clocks differ (" << a.front()->clock << " vs " << b.front()->clock << ")\n";
+        if (!runLevel && a.size() >= 2 && b.size() >= 2) {
+            size_t needed = 2;
+            while (needed < 64 && minimumPValue(needed, needed) > options.alpha) ++needed;
+            out << "warning: " << a.size() << " vs " << b.size() << " runs cannot reach p < " << options.alpha
+                << " (smallest p " << std::setprecision(2) << minimumPValue(a.size(), b.size()) << std::setprecision(6)
+                << "), " << needed << " per side can; testing the latency samples instead\n";
+        }
+
+        std::vector<Row> rows;
+        auto addRow = [&](const std::string& key, bool counter) {
+            std::vector<double> va, vb;
+            for (const BenchmarkRecord* r : a)
+                if (auto v = counter ? r->counter(key) : r->metric(key)) va.push_back(*v);
+            for (const BenchmarkRecord* r : b)
+                if (auto v = counter ? r->counter(key) : r->metric(key)) vb.push_back(*v);
+            if (va.empty() || vb.empty()) return;
+
+            Row row;
+            row.label = counter ? key + "/msg" : key;
+            row.baseline = quantileOf(va, 0.5);
+            row.candidate = quantileOf(vb, 0.5);
+            row.lowerIsBetter = isLowerBetter(key, counter);
+            if (minimumPValue(va.size(), vb.size()) <= options.alpha) {
+                row.tested = true;
+                row.pValue = mannWhitney(va, vb).pValue;
+                row.interval = bootstrapRelativeChange(va, vb, 0.5, 1.0 - options.alpha, options.resamples, options.seed);
+            }
+            rows.push_back(row);
+        };
+        for (const auto& [key, value] : a.front()->metrics) addRow(key, false);
+        for (const auto& [key, value] : a.front()->counters) addRow(key, true);
+
+        // Without enough runs there is no usable run-to-run spread to test
+        // against; the latency samples still support a distribution comparison
+        if (!runLevel) {
+            std::vector<double> sa, sb;
+            for (const BenchmarkRecord* r : a) sa.insert(sa.end(), r->latencySamples.begin(), r->latencySamples.end());
+            for (const BenchmarkRecord* r : b) sb.insert(sb.end(), r->latencySamples.begin(), r->latencySamples.end());
+            if (!sa.empty() && !sb.empty()) {
+                for (double q : {0.5, 0.99}) {
+                    Row row;
+                    row.label = q == 0.5 ? "samples p50_ns" : "samples p99_ns";
+                    row.baseline = quantileOf(sa, q);
+                    row.candidate = quantileOf(sb, q);
+                    row.tested = true;
+                    if (q == 0.5) row.pValue = mannWhitney(sa, sb).pValue;
+                    row.interval = bootstrapRelativeChange(sa, sb, q, 1.0 - options.alpha, options.resamples, options.seed);
+                    rows.push_back(row);
+                }
+            }
+        }
+
+        out << std::left << std::setw(20) << "metric" << std::setw(14) << "baseline" << std::setw(14) << "candidate"
+            << std::setw(10) << "change" << std::setw(22) << "CI" << std::setw(9) << "p" << "verdict\n";
+        for (const Row& row : rows) {
+            double change = row.baseline != 0.0 ? (row.candidate - row.baseline) / row.baseline : 0.0;
+            std::string interval = "-", p = "-", verdict = "untested";
+            if (row.tested) {
+                interval = "[" + percent(row.interval.low) + ", " + percent(row.interval.high) + "]";
+                if (row.pValue >= 0.0 && row.pValue < 1e-4) {
+                    p = "<1e-4";
+                } else if (row.pValue >= 0.0) {
+                    std::ostringstream s;
+                    s << std::setprecision(2) << row.pValue;
+                    p = s.str();
+                }
+                bool excludesZero = row.interval.low > 0.0 || row.interval.high < 0.0;
+                bool significant = excludesZero && (row.pValue < 0.0 || row.pValue < options.alpha);
+                bool worse = row.lowerIsBetter ? change > 0.0 : change < 0.0;
+                if (!significant) verdict = "noise";
+                else if (std::abs(change) < options.threshold) verdict = "below threshold";
+                else if (worse) { verdict = "REGRESSION"; ++regressions; }
+                else verdict = "improved";
+            }
+            out << std::left << std::setw(20) << row.label << std::setw(14) << row.baseline << std::setw(14)
+                << row.candidate << std::setw(10) << percent(change) << std::setw(22) << interval << std::setw(9) << p
+                << verdict << "\n";
+        }
+    }
+
+    for (const BenchmarkRecord& r : candidate)
+        if (std::find(names.begin(), names.end(), r.name) == names.end()) {
+            out << "--- " << r.name << ": no baseline runs\n";
+            names.push_back(r.name);
+        }
+    return regressions;
+}
@@ -0,0 +1,287 @@
+#include <BenchmarkRecord.h>
+#include <LatencyTracker.h>
+#include <Clock.h>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+
+#if __has_include(<GitSha.h>)
+#include <GitSha.h>     // generated at build time by cmake/GitSha.cmake
+#endif
+#ifndef ENGINE_GIT_SHA
+#define ENGINE_GIT_SHA "unknown"
+#endif
+
+#if defined(ENGINE_CLOCK_SIM)
+static const char* CLOCK_NAME = "SIM";
+#elif defined(ENGINE_CLOCK_MONOTONIC)
+static const char* CLOCK_NAME = "MONOTONIC";
+#else
+static const char* CLOCK_NAME = "TSC";
+#endif
+
+BenchmarkRecord BenchmarkRecord::make(std::string name, uint64_t messages) {
+    BenchmarkRecord record;
+    record.name = std::move(name);
+    record.gitSha = ENGINE_GIT_SHA;
+    record.clock = CLOCK_NAME;
+    record.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    record.messages = messages;
+    return record;
+}
+
+void BenchmarkRecord::addCounters(const PerfReading& reading) {
+    if (!reading.valid || messages == 0) return;
+    double n = double(messages);
+    counters.emplace_back("cycles", reading.cycles / n);
+    counters.emplace_back("instructions", reading.instructions / n);
+    counters.emplace_back("cache_misses", reading.cacheMisses / n);
+    counters.emplace_back("branch_misses", reading.branchMisses / n);
+}
+
+void BenchmarkRecord::addParseStats(double seconds, const uint64_t* samples, uint64_t sampleCount) {
+    addMetric("throughput", seconds > 0.0 ? messages / seconds : 0.0);
+    if (sampleCount == 0) return;
+
+    LatencySummary s = LatencyTracker::summarize(samples, sampleCount);
+    addMetric("p50_ns", double(s.median));
+    addMetric("avg_ns", s.avg);
+    addMetric("p99_ns", double(s.p99));
+    addMetric("p999_ns", double(s.p999));
+    addMetric("max_ns", double(s.max));
+
+    // Samples are in arrival order, so a fixed stride keeps bursts and quiet
+    // stretches in proportion
+    uint64_t keep = std::min<uint64_t>(sampleCount, MAX_LATENCY_SAMPLES);
+    latencySamples.reserve(keep);
+    for (uint64_t i = 0; i < keep; ++i)
+        latencySamples.push_back(ticksToNanos(samples[i * sampleCount / keep]));
+}
+
+static std::optional<double> find(const std::vector<std::pair<std::string, double>>& values, const std::string& key) {
+    for (const auto& [k, v] : values)
+        if (k == key) return v;
+    return std::nullopt;
+}
+
+std::optional<double> BenchmarkRecord::metric(const std::string& key) const { return find(metrics, key); }
+std::optional<double> BenchmarkRecord::counter(const std::string& key) const { return find(counters, key); }
+
+// --- writing ---
+
+static void writeString(std::string& out, const std::string& s) {
+    out += '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\') { out += '\\'; out += c; }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        }
+        else out += c;
+    }
+    out += '"';
+}
+
+static void writeNumber(std::string& out, double value, int digits = 10) {
+    if (!std::isfinite(value)) value = 0.0;     // JSON has no inf / nan
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.*g", digits, value);
+    out += buffer;
+}
+
+static void writeObject(std::string& out, const std::vector<std::pair<std::string, double>>& values) {
+    out += '{';
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i) out += ',';
+        writeString(out, values[i].first);
+        out += ':';
+        writeNumber(out, values[i].second);
+    }
+    out += '}';
+}
+
+std::string BenchmarkRecord::toJson() const {
+    std::string out = "{\"name\":";
+    writeString(out, name);
+    out += ",\"git_sha\":";
+    writeString(out, gitSha);
+    out += ",\"clock\":";
+    writeString(out, clock);
+    out += ",\"timestamp\":" + std::to_string(timestamp);
+    out += ",\"messages\":" + std::to_string(messages);
+    out += ",\"metrics\":";
+    writeObject(out, metrics);
+    out += ",\"counters_per_message\":";
+    writeObject(out, counters);
+    out += ",\"latency_samples_ns\":[";
+    for (size_t i = 0; i < latencySamples.size(); ++i) {
+        if (i) out += ',';
+        writeNumber(out, latencySamples[i], 5);
+    }
+    out += "]}";
+    return out;
+}
+
+// --- reading: just enough JSON for the records above, unknown keys skipped ---
+
+namespace {
+
+struct Reader {
+    const std::string& s;
+    size_t pos = 0;
+
+    void ws() { while (pos < s.size() && (s[pos] == ' ' || s[pos] == '\t' || s[pos] == '\r' || s[pos] == '\n')) ++pos; }
+
+    bool eat(char c) {
+        ws();
+        if (pos < s.size() && s[pos] == c) { ++pos; return true; }
+        return false;
+    }
+
+    std::optional<std::string> string() {
+        if (!eat('"')) return std::nullopt;
+        std::string out;
+        while (pos < s.size() && s[pos] != '"') {
+            char c = s[pos++];
+            if (c != '\\') { out += c; continue; }
+            if (pos >= s.size()) return std::nullopt;
+            char e = s[pos++];
+            switch (e) {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'u': {
+                    if (pos + 4 > s.size()) return std::nullopt;
+                    unsigned code = static_cast<unsigned>(std::strtoul(s.substr(pos, 4).c_str(), nullptr, 16));
+                    out += code < 0x80 ? static_cast<char>(code) : '?';
+                    pos += 4;
+                    break;
+                }
+                default: out += e;
+            }
+        }
+        if (pos >= s.size()) return std::nullopt;
+        ++pos;
+        return out;
+    }
+
+    std::optional<double> number() {
+        ws();
+        const char* begin = s.c_str() + pos;
+        char* end = nullptr;
+        double value = std::strtod(begin, &end);
+        if (end == begin) return std::nullopt;
+        pos += static_cast<size_t>(end - begin);
+        return value;
+    }
+
+    // { "key": number, ... }
+    bool numberObject(std::vector<std::pair<std::string, double>>& out) {
+        if (!eat('{')) return false;
+        if (eat('}')) return true;
+        do {
+            auto key = string();
+            if (!key || !eat(':')) return false;
+            auto value = number();
+            if (!value) return false;
+            out.emplace_back(*key, *value);
+        } while (eat(','));
+        return eat('}');
+    }
+
+    bool numberArray(std::vector<double>& out) {
+        if (!eat('[')) return false;
+        if (eat(']')) return true;
+        do {
+            auto value = number();
+            if (!value) return false;
+            out.push_back(*value);
+        } while (eat(','));
+        return eat(']');
+    }
+
+    bool skipValue() {
+        ws();
+        if (pos >= s.size()) return false;
+        char c = s[pos];
+        if (c == '"') return string().has_value();
+        if (c == '{' || c == '[') {
+            char close = c == '{' ? '}' : ']';
+            ++pos;
+            if (eat(close)) return true;
+            do {
+                if (c == '{' && (!string() || !eat(':'))) return false;
+                if (!skipValue()) return false;
+            } while (eat(','));
+            return eat(close);
+        }
+        for (const char* word : {"true", "false", "null"}) {
+            size_t n = std::char_traits<char>::length(word);
+            if (s.compare(pos, n, word) == 0) { pos += n; return true; }
+        }
+        return number().has_value();
+    }
+};
+
+}
+
+std::optional<BenchmarkRecord> BenchmarkRecord::fromJson(const std::string& line) {
+    Reader in{line};
+    BenchmarkRecord record;
+    if (!in.eat('{')) return std::nullopt;
+    if (in.eat('}')) return std::nullopt;
+
+    do {
+        auto key = in.string();
+        if (!key || !in.eat(':')) return std::nullopt;
+        bool ok = true;
+        if (*key == "name" || *key == "git_sha" || *key == "clock") {
+            auto value = in.string();
+            ok = value.has_value();
+            if (ok) (*key == "name" ? record.name : *key == "git_sha" ? record.gitSha : record.clock) = *value;
+        } else if (*key == "timestamp" || *key == "messages") {
+            auto value = in.number();
+            ok = value.has_value();
+            if (ok) (*key == "timestamp" ? record.timestamp : record.messages) = static_cast<uint64_t>(*value);
+        } else if (*key == "metrics") {
+            ok = in.numberObject(record.metrics);
+        } else if (*key == "counters_per_message") {
+            ok = in.numberObject(record.counters);
+        } else if (*key == "latency_samples_ns") {
+            ok = in.numberArray(record.latencySamples);
+        } else {
+            ok = in.skipValue();
+        }
+        if (!ok) return std::nullopt;
+    } while (in.eat(','));
+
+    if (!in.eat('}') || record.name.empty()) return std::nullopt;
+    return record;
+}
+
+bool BenchmarkRecord::append(const std::string& path, const BenchmarkRecord& record) {
+    std::ofstream out(path, std::ios::app);
+    if (!out) return false;
+    out << record.toJson() << '\n';
+    return static_cast<bool>(out);
+}
+
+std::vector<BenchmarkRecord> BenchmarkRecord::load(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Cannot read benchmark records from " + path);
+
+    std::vector<BenchmarkRecord> records;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (auto record = fromJson(line)) records.push_back(std::move(*record));
+    }
+    return records;
+}
@@ -0,0 +1,32 @@
+#include <Modes.h>
+#include <ModeSupport.h>
+#include <BenchmarkCompare.h>
+#include <cstdlib>
+#include <iostream>
+
+// Baseline vs candidate record files; exit status 2 when a regression
+// stands out from the run-to-run noise
+int compareRecords(int argc, char** argv) {
+    std::vector<std::string> args(argv, argv + argc);
+    std::string alpha, threshold;
+    if (!takeValueOption(args, "--alpha", alpha) || !takeValueOption(args, "--threshold", threshold) || args.size() != 2) {
+        std::cerr << "Usage: compare <baseline.jsonl> <candidate.jsonl> [--alpha 0.05] [--threshold <percent>]\n";
+        return 1;
+    }
+
+    CompareOptions options;
+    if (!alpha.empty()) options.alpha = std::strtod(alpha.c_str(), nullptr);
+    if (!threshold.empty()) options.threshold = std::strtod(threshold.c_str(), nullptr) / 100.0;
+
+    try {
+        std::vector<BenchmarkRecord> baseline = BenchmarkRecord::load(args[0]);
+        std::vector<BenchmarkRecord> candidate = BenchmarkRecord::load(args[1]);
+        size_t regressions = BenchmarkCompare::compare(baseline, candidate, options, std::cout);
+        std::cout << "\n" << regressions << (regressions == 1 ? " regression" : " regressions")
+                  << " (alpha " << options.alpha << ", threshold " << options.threshold * 100.0 << "%)\n";
+        return regressions ? 2 : 0;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,62 @@
+#include <Corpus.h>
+#include <MessageParser.h>
+#include <WireOrder.h>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+bool Corpus::write(const std::string& path, const Scenario& scenario) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+
+    CorpusHeader h{};
+    h.magic = MAGIC;
+    h.version = VERSION;
+    h.messageSize = sizeof(WireOrder);
+    h.count = scenario.messages;
+    h.dataOffset = 64;
+    uint8_t head[64]{};
+    std::memcpy(head, &h, sizeof(h));
+    file.write(reinterpret_cast<const char*>(head), sizeof(head));
+
+    // Serialized in chunks so corpus size is not bounded by memory
+    MessageParser parser;
+    LoadGenerator generator(scenario);
+    std::vector<uint8_t> chunk(4096 * sizeof(WireOrder));
+    while (!generator.done()) {
+        size_t n = 0;
+        for (; n < 4096 && !generator.done(); ++n)
+            parser.serializeTo(generator.next(), chunk.data() + n * sizeof(WireOrder));
+        file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(n * sizeof(WireOrder)));
+    }
+    return static_cast<bool>(file);
+}
+
+Corpus::Corpus(const std::string& path) : file_(path, true) {
+    if (file_.size() < sizeof(CorpusHeader))
+        throw std::runtime_error("Corpus too small: " + path);
+    header_ = reinterpret_cast<const CorpusHeader*>(file_.data());
+    if (header_->magic != MAGIC || header_->version != VERSION || header_->messageSize != sizeof(WireOrder))
+        throw std::runtime_error("Not a corpus of this build's WireOrder: " + path);
+    // Checked by division, so a corrupt count cannot wrap the bound
+    const CorpusHeader& h = *header_;
+    const size_t size = file_.size();
+    if (h.dataOffset < sizeof(CorpusHeader) || h.dataOffset % 64 != 0 || h.dataOffset > size)
+        throw std::runtime_error("Corrupt corpus (data offset " + std::to_string(h.dataOffset) + "): " + path);
+    if (h.count > (size - h.dataOffset) / h.messageSize)
+        throw std::runtime_error("Corpus truncated: " + path);
+}
+
+const uint8_t* Corpus::messages() const {
+    return file_.data() + header_->dataOffset;
+}
+
+uint64_t Corpus::count() const {
+    return header_->count;
+}
+
+size_t Corpus::messageSize() const {
+    return header_->messageSize;
+}
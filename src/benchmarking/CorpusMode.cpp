@@ -0,0 +1,35 @@
+#include <Modes.h>
+#include <LoadGenerator.h>
+#include <Corpus.h>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static const Scenario* findScenario(const std::vector<Scenario>& scenarios, const std::string& name) {
+    for (const Scenario& scenario : scenarios)
+        if (scenario.name == name) return &scenario;
+    return nullptr;
+}
+
+int writeCorpus(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: corpus <scenario> <path> [messages]\n";
+        return 1;
+    }
+    std::vector<Scenario> scenarios = LoadGenerator::defaultScenarios();
+    const Scenario* found = findScenario(scenarios, argv[0]);
+    if (!found) {
+        std::cerr << "Unknown scenario " << argv[0] << "\n";
+        return 1;
+    }
+    Scenario scenario = *found;
+    if (argc > 2) scenario.messages = std::strtoull(argv[2], nullptr, 10);
+
+    if (!Corpus::write(argv[1], scenario)) {
+        std::cerr << "Failed to write " << argv[1] << "\n";
+        return 1;
+    }
+    std::cout << "Wrote " << scenario.messages << " " << scenario.name << " messages to " << argv[1] << "\n";
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include <HiccupMeter.h>
+#include <ThreadAffinity.h>
+#include <algorithm>
+#include <future>
+
+HiccupMeter::HiccupMeter(uint64_t thresholdNs, size_t maxEvents)
+    : thresholdTicks_(std::max<uint64_t>(nanosToTicks(thresholdNs), 1)), maxEvents_(maxEvents) {
+    events_.reserve(maxEvents_);
+}
+
+HiccupMeter::~HiccupMeter() {
+    stop();
+}
+
+bool HiccupMeter::start(int cpu) {
+    if (thread_.joinable()) return false;
+    std::promise<bool> pinned;
+    std::future<bool> result = pinned.get_future();
+
+    running_.store(true, std::memory_order_relaxed);
+    // The thread owns the promise: set_value may still be touching it after get() returns here
+    thread_ = std::thread([this, cpu, pinned = std::move(pinned)]() mutable {
+        pinned.set_value(cpu < 0 || ThreadAffinity::pinCurrentThread(static_cast<unsigned>(cpu)));
+        arm();
+        while (running_.load(std::memory_order_relaxed)) tick();
+    });
+    return result.get();
+}
+
+void HiccupMeter::stop() {
+    running_.store(false, std::memory_order_relaxed);
+    if (thread_.joinable()) thread_.join();
+}
+
+void HiccupMeter::record(uint64_t from, uint64_t to) {
+    histogram_.record(static_cast<uint64_t>(ticksToNanos(to - from)));
+    if (events_.size() < maxEvents_) events_.push_back(Hiccup{from, to - from});
+    else ++dropped_;
+}
+
+HiccupCorrelation HiccupMeter::correlate(const std::vector<Hiccup>& hiccups, const std::vector<LatencyOutlier>& outliers) {
+    HiccupCorrelation result;
+    result.outliers = outliers.size();
+
+    // One meter's hiccups never overlap each other, so both their starts and
+    // ends ascend and a single forward cursor serves every outlier
+    size_t h = 0;
+    for (const LatencyOutlier& o : outliers) {
+        while (h < hiccups.size() && hiccups[h].start + hiccups[h].ticks <= o.start) ++h;
+        bool overlaps = h < hiccups.size() && hiccups[h].start < o.start + o.ticks;
+        uint64_t ns = static_cast<uint64_t>(ticksToNanos(o.ticks));
+        if (overlaps) {
+            ++result.explained;
+            result.worstExplainedNs = std::max(result.worstExplainedNs, ns);
+        } else {
+            result.worstUnexplainedNs = std::max(result.worstUnexplainedNs, ns);
+        }
+    }
+    return result;
+}
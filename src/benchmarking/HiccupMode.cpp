@@ -0,0 +1,116 @@
+#include <Modes.h>
+#include <ModeSupport.h>
+#include <Clock.h>
+#include <MessageParser.h>
+#include <Corpus.h>
+#include <ThreadAffinity.h>
+#include <HiccupMeter.h>
+#include <LatencyHistogram.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+// Parses a corpus while a HiccupMeter watches for stalls, then checks which
+// parse outliers coincide with one. A meter thread on another cpu only sees
+// stalls that reach it too (SMIs, say); interrupts or preemption on the
+// parser's own cpu leave outliers it cannot explain, so "not during a
+// hiccup" is not proof the parse path is at fault
+int hiccupCorpus(int argc, char** argv) {
+    std::vector<std::string> args(argv, argv + argc);
+    std::string mode = "thread", threshold, cpu, passes;
+    StageOptions stages;
+    if (!takeValueOption(args, "--mode", mode) || !takeValueOption(args, "--threshold", threshold)
+        || !takeValueOption(args, "--cpu", cpu) || !takeValueOption(args, "--passes", passes)
+        || !takeStageOptions(args, stages) || stages.dedup || stages.risk || args.size() != 1 || (mode != "thread" && mode != "hook")) {
+        std::cerr << "Usage: hiccup <corpus> [--mode thread|hook] [--threshold ns] [--cpu n] [--passes n] [--secmaster <file>]\n";
+        return 1;
+    }
+    const uint64_t thresholdNs = threshold.empty() ? 1000 : std::strtoull(threshold.c_str(), nullptr, 10);
+    const size_t passCount = passes.empty() ? 1 : std::max<size_t>(1, std::strtoull(passes.c_str(), nullptr, 10));
+
+    try {
+        Corpus corpus(args[0]);
+        const uint8_t* data = corpus.messages();
+        const size_t size = corpus.messageSize();
+        const uint64_t count = corpus.count();
+
+        // Parser on the first allowed CPU, meter thread on another one
+        std::vector<unsigned> cpus = ThreadAffinity::allowedCpus();
+        int meterCpu = !cpu.empty() ? std::atoi(cpu.c_str()) : cpus.size() > 1 ? static_cast<int>(cpus[1]) : -1;
+        std::vector<unsigned> pinned{cpus[0]};
+        if (mode == "thread" && meterCpu >= 0) pinned.push_back(static_cast<unsigned>(meterCpu));
+        if (!tuningAllows(pinned)) return 1;
+        ThreadAffinity::pinCurrentThread(cpus[0]);
+
+        MessageParser parser;
+        parser.setSecurityMaster(loadSecurityMaster(stages));
+        DiscardSink sink;
+        HiccupMeter meter(thresholdNs);
+        MessageParser::resetLatency();
+        MessageParser::setOutlierThreshold(thresholdNs);
+
+        std::cout << "=== Hiccups: " << args[0] << " (" << count * passCount << " messages, " << mode
+                  << " mode, threshold " << thresholdNs << " ns) ===\n";
+        if (mode == "thread") {
+            if (meterCpu < 0) {
+                std::cout << "warning: one CPU only, the meter thread shares it with the parser (try --mode hook)\n";
+                meter.start();
+            } else if (!meter.start(meterCpu)) {
+                std::cout << "warning: could not pin the meter to cpu " << meterCpu << "\n";
+            }
+        } else {
+            meter.arm();
+        }
+
+        uint64_t start = EngineClock::now();
+        for (size_t pass = 0; pass < passCount; ++pass) {
+            for (uint64_t i = 0; i < count; ++i) {
+                auto parsedOrder = parser.parse(data + i * size, size);
+                if (parsedOrder) sink.consume(*parsedOrder);
+                if (mode == "hook") meter.tick();
+            }
+        }
+        uint64_t end = EngineClock::now();
+        meter.stop();
+        MessageParser::setOutlierThreshold(0);
+
+        const LatencyHistogram& gaps = meter.histogram();
+        double seconds = ticksToNanos(end - start) / 1e9;
+        uint64_t lostTicks = 0;
+        for (const Hiccup& h : meter.events()) lostTicks += h.ticks;
+
+        std::cout << "Run: " << seconds << " s, " << meter.reads() << " clock reads by the meter (checksum "
+                  << sink.checksum() << ")\n";
+        std::cout << "Hiccups: " << gaps.count() << (meter.dropped() ? " (timestamps kept for the first " + std::to_string(meter.events().size()) + ")" : "")
+                  << ", " << ticksToNanos(lostTicks) / 1e6 << " ms lost (" << perSecond(ticksToNanos(lostTicks) / 1e7, seconds) << "% of the run)\n";
+        if (gaps.count())
+            std::cout << "Gap ns: p50 " << gaps.percentile(50) << ", p90 " << gaps.percentile(90) << ", p99 "
+                      << gaps.percentile(99) << ", max " << gaps.max() << "\n";
+
+        std::vector<Hiccup> longest = meter.events();
+        std::sort(longest.begin(), longest.end(), [](const Hiccup& a, const Hiccup& b) { return a.ticks > b.ticks; });
+        if (longest.size() > 10) longest.resize(10);
+        for (const Hiccup& h : longest) {
+            // The thread meter may stall before the timed loop starts
+            double at = h.start >= start ? ticksToNanos(h.start - start) / 1e3 : -ticksToNanos(start - h.start) / 1e3;
+            std::cout << "  at " << std::fixed << std::setprecision(1) << at << " us: " << ticksToNanos(h.ticks) / 1e3
+                      << " us\n" << std::defaultfloat << std::setprecision(6);
+        }
+
+        HiccupCorrelation c = HiccupMeter::correlate(meter.events(), MessageParser::getOutliers());
+        std::cout << "Parse outliers above " << thresholdNs << " ns: " << c.outliers;
+        if (c.outliers) {
+            std::cout << ", " << c.explained << " during a hiccup (worst " << c.worstExplainedNs << " ns), "
+                      << c.outliers - c.explained << " not (worst " << c.worstUnexplainedNs << " ns)";
+        }
+        std::cout << "\n";
+        if (mode == "hook") std::cout << "(hook mode: gaps include the loop's own work, so slow parses also show up as hiccups)\n";
+        else std::cout << "(thread mode: only stalls that also reach the meter's cpu are seen, such as SMIs; interrupts or\n"
+                          " preemption on the parser's cpu count as \"not\", so cross-check with --mode hook)\n";
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <LatencyHistogram.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+
+namespace {
+    constexpr uint64_t SUB = uint64_t(1) << LatencyHistogram::SUB_BITS;
+    constexpr uint64_t HALF = SUB / 2;
+    constexpr size_t BUCKETS = SUB + (LatencyHistogram::MAX_BITS - LatencyHistogram::SUB_BITS) * HALF;
+}
+
+LatencyHistogram::LatencyHistogram() : counts_(BUCKETS, 0) {}
+
+// Octave k >= 1 (values in [2^(SUB_BITS+k-1), 2^(SUB_BITS+k))) keeps the top
+// SUB_BITS bits of the value, i.e. HALF buckets of width 2^k
+size_t LatencyHistogram::bucketIndex(uint64_t value) {
+    if (value < SUB) return static_cast<size_t>(value);
+    unsigned msb = 63u - static_cast<unsigned>(std::countl_zero(value));
+    unsigned shift = msb - (SUB_BITS - 1);
+    size_t index = SUB + size_t(shift - 1) * HALF + size_t((value >> shift) - HALF);
+    return std::min(index, BUCKETS - 1);
+}
+
+uint64_t LatencyHistogram::bucketUpper(size_t index) {
+    if (index < SUB) return index;
+    size_t k = index - SUB;
+    unsigned shift = static_cast<unsigned>(k / HALF) + 1;
+    uint64_t sub = k % HALF + HALF;
+    return ((sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t value) {
+    ++counts_[bucketIndex(value)];
+    ++count_;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    sum_ += double(value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < BUCKETS; ++i) counts_[i] += other.counts_[i];
+    count_ += other.count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    sum_ += other.sum_;
+}
+
+void LatencyHistogram::reset() {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    count_ = 0;
+    min_ = UINT64_MAX;
+    max_ = 0;
+    sum_ = 0.0;
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+    if (count_ == 0) return 0;
+    uint64_t target = static_cast<uint64_t>(std::ceil(std::clamp(p, 0.0, 100.0) / 100.0 * double(count_)));
+    target = std::max<uint64_t>(target, 1);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        seen += counts_[i];
+        if (seen >= target) return std::clamp(bucketUpper(i), min_, max_);
+    }
+    return max_;
+}
+
+uint64_t LatencyHistogram::count() const {
+    return count_;
+}
+
+uint64_t LatencyHistogram::min() const {
+    return count_ ? min_ : 0;
+}
+
+uint64_t LatencyHistogram::max() const {
+    return max_;
+}
+
+double LatencyHistogram::mean() const {
+    return count_ ? sum_ / double(count_) : 0.0;
+}
+
+void LatencyHistogram::print(std::ostream& out, const std::string& indent) const {
+    if (count_ == 0) return;
+    // Buckets never straddle a power of two, so each falls in its upper bound's band
+    uint64_t bands[65] = {};
+    for (size_t i = 0; i < BUCKETS; ++i)
+        if (counts_[i]) bands[std::bit_width(bucketUpper(i))] += counts_[i];
+
+    size_t first = 0, last = 64;
+    while (!bands[first]) ++first;
+    while (!bands[last]) --last;
+    const uint64_t fullest = *std::max_element(bands + first, bands + last + 1);
+    for (size_t b = first; b <= last; ++b) {
+        uint64_t low = b ? uint64_t(1) << (b - 1) : 0;
+        uint64_t high = b ? (b == 64 ? UINT64_MAX : (uint64_t(1) << b) - 1) : 0;
+        std::string range = std::to_string(low) + "-" + std::to_string(high);
+        out << indent << std::right << std::setw(24) << range << " " << std::setw(10) << bands[b] << " "
+            << std::string(static_cast<size_t>(40 * bands[b] / fullest), '#') << std::left << "\n";
+    }
+}
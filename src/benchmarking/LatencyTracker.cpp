@@ -5,33 +5,42 @@
 #include <inttypes.h>
 #include <MessageParser.h>
 #include <LatencyTracker.h>
+#include <Clock.h>
 
 
+LatencySummary LatencyTracker::summarize(const uint64_t* samples, uint64_t count) {
+    LatencySummary summary;
+    if (count == 0) return summary;
+
+    // Convert only the valid samples into a vector for analysis, in ns
+    std::vector<uint64_t> sorted(count);
+    for (uint64_t i = 0; i < count; ++i)
+        sorted[i] = static_cast<uint64_t>(ticksToNanos(samples[i]));
+    std::sort(sorted.begin(), sorted.end());
+
+    summary.count = count;
+    summary.min = sorted.front();
+    summary.max = sorted.back();
+    summary.avg = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    summary.median = sorted[sorted.size() / 2];
+    summary.p99 = sorted[static_cast<size_t>(sorted.size() * 0.99)];
+    summary.p999 = sorted[static_cast<size_t>(sorted.size() * 0.999)];
+    return summary;
+}
+
 void LatencyTracker::analyzeLatencies(uint64_t (&timestampArr)[MessageParser::MAX_SAMPLES], uint64_t count) {
     if (count == 0) {
         std::cout << "No latency data recorded.\n";
         return;
     }
 
-    // Convert only the valid samples into a vector for analysis
-    std::vector<uint64_t> latencies(timestampArr, timestampArr + count);
-
-    auto min = *std::min_element(latencies.begin(), latencies.end());
-    auto max = *std::max_element(latencies.begin(), latencies.end());
-    double avg = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
-
-    std::vector<uint64_t> sorted = latencies;
-    std::sort(sorted.begin(), sorted.end());
-
-    uint64_t median = sorted[sorted.size() / 2];
-    uint64_t p99 = sorted[static_cast<size_t>(sorted.size() * 0.99)];
-    uint64_t p999 = sorted[static_cast<size_t>(sorted.size() * 0.999)];
+    LatencySummary s = summarize(timestampArr, count);
 
-    std::cout << "Count: " << latencies.size() << "\n";
-    std::cout << "Min: " << min << " ns\n";
-    std::cout << "Median: " << median << " ns\n";
-    std::cout << "Avg: " << avg << " ns\n";
-    std::cout << "99th percentile: " << p99 << " ns\n";
-    std::cout << "99.9th percentile: " << p999 << " ns\n";
-    std::cout << "Max: " << max << " ns\n";
+    std::cout << "Count: " << s.count << "\n";
+    std::cout << "Min: " << s.min << " ns\n";
+    std::cout << "Median: " << s.median << " ns\n";
+    std::cout << "Avg: " << s.avg << " ns\n";
+    std::cout << "99th percentile: " << s.p99 << " ns\n";
+    std::cout << "99.9th percentile: " << s.p999 << " ns\n";
+    std::cout << "Max: " << s.max << " ns\n";
 }
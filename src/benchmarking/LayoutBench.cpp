@@ -0,0 +1,296 @@
+#include <LayoutBench.h>
+#include <MessageParser.h>
+#include <Order.h>
+#include <Clock.h>
+#include <cstring>
+
+namespace {
+
+struct CompactOrder {
+    uint64_t order_id;
+    uint64_t timestamp_ns;
+    char symbol[8];
+    double price;
+    uint32_t quantity;
+    Side side;
+    OrderType type;
+};
+static_assert(sizeof(CompactOrder) == 40, "CompactOrder must be 40 bytes");
+
+// 32-byte aligned so two records share a line and none straddles one
+struct alignas(32) HotOrder {
+    uint64_t order_id;
+    uint64_t symbol;
+    double price;
+    uint32_t quantity;
+    Side side;
+    OrderType type;
+};
+static_assert(sizeof(HotOrder) == 32, "HotOrder must be 32 bytes");
+
+struct ColdOrder {
+    uint64_t timestamp_ns;
+    uint32_t instrument_id;
+};
+
+constexpr uint64_t LINE = 64;
+
+uint64_t symbolKey(const char* symbol) {
+    uint64_t key;
+    std::memcpy(&key, symbol, sizeof(key));
+    return key;
+}
+
+// Every store answers the same per-order accessors, so the workload loops
+// below are written once and the compiler sees each layout's real accesses.
+// The *Bytes constants model what a workload pulls through the caches per
+// order: whole records for AoS streams, only the touched columns for SoA,
+// and whole lines for random access.
+
+struct Aos64Store {
+    std::vector<Order> orders;
+    explicit Aos64Store(uint64_t n) : orders(n) {}
+
+    void put(uint64_t i, const Order& o) { orders[i] = o; }
+    uint64_t id(uint64_t i) const { return orders[i].order_id; }
+    uint64_t symbol(uint64_t i) const { return symbolKey(orders[i].symbol); }
+    double price(uint64_t i) const { return orders[i].price; }
+    uint32_t quantity(uint64_t i) const { return orders[i].quantity; }
+    int side(uint64_t i) const { return static_cast<int8_t>(orders[i].side); }
+
+    static constexpr uint64_t storeBytes = sizeof(Order);
+    static constexpr uint64_t scanBytes = sizeof(Order);
+    static constexpr uint64_t notionalBytes = sizeof(Order);
+    static constexpr uint64_t lookupBytes = LINE;
+};
+
+struct Compact40Store {
+    std::vector<CompactOrder> orders;
+    explicit Compact40Store(uint64_t n) : orders(n) {}
+
+    void put(uint64_t i, const Order& o) {
+        CompactOrder& c = orders[i];
+        c.order_id = o.order_id;
+        c.timestamp_ns = o.timestamp_ns;
+        std::memcpy(c.symbol, o.symbol, sizeof(c.symbol));
+        c.price = o.price;
+        c.quantity = o.quantity;
+        c.side = o.side;
+        c.type = o.type;
+    }
+    uint64_t id(uint64_t i) const { return orders[i].order_id; }
+    uint64_t symbol(uint64_t i) const { return symbolKey(orders[i].symbol); }
+    double price(uint64_t i) const { return orders[i].price; }
+    uint32_t quantity(uint64_t i) const { return orders[i].quantity; }
+    int side(uint64_t i) const { return static_cast<int8_t>(orders[i].side); }
+
+    static constexpr uint64_t storeBytes = sizeof(CompactOrder);
+    static constexpr uint64_t scanBytes = sizeof(CompactOrder);
+    static constexpr uint64_t notionalBytes = sizeof(CompactOrder);
+    static constexpr uint64_t lookupBytes = 3 * LINE / 2;   // half of 40-byte records at 8-byte steps straddle a line
+};
+
+struct HotCold32Store {
+    std::vector<HotOrder> hot;
+    std::vector<ColdOrder> cold;
+    explicit HotCold32Store(uint64_t n) : hot(n), cold(n) {}
+
+    void put(uint64_t i, const Order& o) {
+        HotOrder& h = hot[i];
+        h.order_id = o.order_id;
+        h.symbol = symbolKey(o.symbol);
+        h.price = o.price;
+        h.quantity = o.quantity;
+        h.side = o.side;
+        h.type = o.type;
+        cold[i] = ColdOrder{o.timestamp_ns, o.instrument_id};
+    }
+    uint64_t id(uint64_t i) const { return hot[i].order_id; }
+    uint64_t symbol(uint64_t i) const { return hot[i].symbol; }
+    double price(uint64_t i) const { return hot[i].price; }
+    uint32_t quantity(uint64_t i) const { return hot[i].quantity; }
+    int side(uint64_t i) const { return static_cast<int8_t>(hot[i].side); }
+
+    static constexpr uint64_t storeBytes = sizeof(HotOrder) + sizeof(ColdOrder);
+    static constexpr uint64_t scanBytes = sizeof(HotOrder);
+    static constexpr uint64_t notionalBytes = sizeof(HotOrder);
+    static constexpr uint64_t lookupBytes = LINE;
+};
+
+struct SoaStore {
+    std::vector<uint64_t> ids, timestamps, symbols;
+    std::vector<double> prices;
+    std::vector<uint32_t> quantities, instruments;
+    std::vector<int8_t> sides;
+    std::vector<uint8_t> types;
+
+    explicit SoaStore(uint64_t n)
+        : ids(n), timestamps(n), symbols(n), prices(n), quantities(n), instruments(n), sides(n), types(n) {}
+
+    void put(uint64_t i, const Order& o) {
+        ids[i] = o.order_id;
+        timestamps[i] = o.timestamp_ns;
+        symbols[i] = symbolKey(o.symbol);
+        prices[i] = o.price;
+        quantities[i] = o.quantity;
+        instruments[i] = o.instrument_id;
+        sides[i] = static_cast<int8_t>(o.side);
+        types[i] = static_cast<uint8_t>(o.type);
+    }
+    uint64_t id(uint64_t i) const { return ids[i]; }
+    uint64_t symbol(uint64_t i) const { return symbols[i]; }
+    double price(uint64_t i) const { return prices[i]; }
+    uint32_t quantity(uint64_t i) const { return quantities[i]; }
+    int side(uint64_t i) const { return sides[i]; }
+
+    static constexpr uint64_t storeBytes = 8 + 8 + 8 + 8 + 4 + 4 + 1 + 1;
+    static constexpr uint64_t scanBytes = 8;                    // symbols; matching quantities are noise
+    static constexpr uint64_t notionalBytes = 8 + 4 + 1;
+    static constexpr uint64_t lookupBytes = 3 * LINE;           // id, price and quantity arrays
+};
+
+uint64_t mix(uint64_t h, uint64_t v) {
+    return (h ^ v) * 0x100000001B3ull;
+}
+
+uint64_t doubleBits(double d) {
+    uint64_t bits;
+    std::memcpy(&bits, &d, sizeof(bits));
+    return bits;
+}
+
+template <typename Work>
+LayoutResult timed(LayoutWorkload workload, PerfCounters& counters, Work&& work) {
+    LayoutResult result;
+    result.workload = workload;
+    counters.start();
+    uint64_t start = EngineClock::now();
+    work(result);
+    result.seconds = ticksToNanos(EngineClock::now() - start) / 1e9;
+    result.counters = counters.stop();
+    return result;
+}
+
+template <typename Store>
+std::vector<LayoutResult> runLayout(const uint8_t* messages, size_t messageSize, uint64_t count,
+                                    uint64_t lookups, size_t passes) {
+    std::vector<LayoutResult> results;
+    PerfCounters counters;
+    MessageParser parser;
+    Store store(count);
+    uint64_t stored = 0;
+
+    LayoutResult parse = timed(LayoutWorkload::Parse, counters, [&](LayoutResult& r) {
+        for (uint64_t i = 0; i < count; ++i) {
+            auto parsedOrder = parser.parse(messages + i * messageSize, messageSize);
+            if (parsedOrder) store.put(stored++, *parsedOrder);
+        }
+        r.items = count;
+        r.traffic = stored * Store::storeBytes;
+    });
+    // Read back outside the timed loop: proves the layout kept every field the workloads need
+    for (uint64_t i = 0; i < stored; ++i)
+        parse.checksum = mix(mix(mix(mix(parse.checksum, store.id(i)), store.symbol(i)), doubleBits(store.price(i))),
+                             store.quantity(i) * 3 + store.side(i));
+    results.push_back(parse);
+    if (stored == 0) return results;
+
+    const uint64_t target = store.symbol(0);
+    results.push_back(timed(LayoutWorkload::ScanSymbol, counters, [&](LayoutResult& r) {
+        uint64_t matches = 0, quantity = 0;
+        for (size_t pass = 0; pass < passes; ++pass) {
+            for (uint64_t i = 0; i < stored; ++i) {
+                if (store.symbol(i) == target) {
+                    ++matches;
+                    quantity += store.quantity(i);
+                }
+            }
+        }
+        r.items = stored * passes;
+        r.traffic = stored * passes * Store::scanBytes;
+        r.checksum = mix(matches, quantity);
+    }));
+
+    results.push_back(timed(LayoutWorkload::SumNotional, counters, [&](LayoutResult& r) {
+        double total = 0.0;
+        for (size_t pass = 0; pass < passes; ++pass) {
+            // Four chains so the FP add latency does not hide the memory cost
+            double sum[4] = {};
+            uint64_t i = 0;
+            for (; i + 4 <= stored; i += 4)
+                for (uint64_t k = 0; k < 4; ++k)
+                    sum[k] += store.price(i + k) * store.quantity(i + k) * store.side(i + k);
+            for (; i < stored; ++i) sum[0] += store.price(i) * store.quantity(i) * store.side(i);
+            total += (sum[0] + sum[1]) + (sum[2] + sum[3]);
+        }
+        r.items = stored * passes;
+        r.traffic = stored * passes * Store::notionalBytes;
+        r.checksum = doubleBits(total);
+    }));
+
+    // Same seeded positions for every layout; generated before timing
+    std::vector<uint32_t> positions(lookups);
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (uint32_t& p : positions) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        p = static_cast<uint32_t>(state % stored);
+    }
+    results.push_back(timed(LayoutWorkload::RandomAccess, counters, [&](LayoutResult& r) {
+        uint64_t h = 0;
+        double notional = 0.0;
+        for (uint32_t p : positions) {
+            h += store.id(p) ^ store.quantity(p);
+            notional += store.price(p);
+        }
+        r.items = lookups;
+        r.traffic = lookups * Store::lookupBytes;
+        r.checksum = mix(h, doubleBits(notional));
+    }));
+    return results;
+}
+
+}
+
+const char* orderLayoutName(OrderLayout layout) {
+    switch (layout) {
+        case OrderLayout::Aos64:     return "aos64";
+        case OrderLayout::Compact40: return "compact40";
+        case OrderLayout::HotCold32: return "hotcold32";
+        case OrderLayout::Soa:       return "soa";
+    }
+    return "?";
+}
+
+const char* layoutWorkloadName(LayoutWorkload workload) {
+    switch (workload) {
+        case LayoutWorkload::Parse:        return "parse";
+        case LayoutWorkload::ScanSymbol:   return "scan-symbol";
+        case LayoutWorkload::SumNotional:  return "sum-notional";
+        case LayoutWorkload::RandomAccess: return "random-access";
+    }
+    return "?";
+}
+
+size_t LayoutBench::bytesPerOrder(OrderLayout layout) {
+    switch (layout) {
+        case OrderLayout::Aos64:     return Aos64Store::storeBytes;
+        case OrderLayout::Compact40: return Compact40Store::storeBytes;
+        case OrderLayout::HotCold32: return HotCold32Store::storeBytes;
+        case OrderLayout::Soa:       return SoaStore::storeBytes;
+    }
+    return 0;
+}
+
+std::vector<LayoutResult> LayoutBench::run(OrderLayout layout, const uint8_t* messages, size_t messageSize,
+                                           uint64_t count, uint64_t lookups, size_t passes) {
+    if (passes == 0) passes = 1;
+    switch (layout) {
+        case OrderLayout::Aos64:     return runLayout<Aos64Store>(messages, messageSize, count, lookups, passes);
+        case OrderLayout::Compact40: return runLayout<Compact40Store>(messages, messageSize, count, lookups, passes);
+        case OrderLayout::HotCold32: return runLayout<HotCold32Store>(messages, messageSize, count, lookups, passes);
+        case OrderLayout::Soa:       return runLayout<SoaStore>(messages, messageSize, count, lookups, passes);
+    }
+    return {};
+}
@@ -0,0 +1,80 @@
+#include <Modes.h>
+#include <ModeSupport.h>
+#include <Corpus.h>
+#include <ThreadAffinity.h>
+#include <LayoutBench.h>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// The same parse / scan / notional / random-access workloads over four
+// Order storage layouts, to show what the 64-byte padding costs or buys
+int layoutCorpus(int argc, char** argv) {
+    std::vector<std::string> args(argv, argv + argc);
+    RecordOptions record;
+    if (args.empty() || !takeRecordOptions(args, record)) {
+        std::cerr << "Usage: layout <corpus> [lookups] [--record <file>] [--repeat <n>]\n";
+        return 1;
+    }
+
+    try {
+        Corpus corpus(args[0]);
+        const uint64_t count = corpus.count();
+        const uint64_t lookups = args.size() > 1 ? std::strtoull(args[1].c_str(), nullptr, 10) : count;
+        const std::string source = args[0].substr(args[0].find_last_of("/\\") + 1);
+        constexpr size_t PASSES = 5;
+        if (!tuningAllows({ThreadAffinity::allowedCpus()[0]})) return 1;
+
+        const OrderLayout layouts[] = {OrderLayout::Aos64, OrderLayout::Compact40, OrderLayout::HotCold32, OrderLayout::Soa};
+        std::cout << "=== Layouts: " << args[0] << " (" << count << " orders, " << lookups << " lookups, "
+                  << PASSES << " passes per scan) ===\n";
+        for (OrderLayout layout : layouts)
+            std::cout << std::left << std::setw(11) << orderLayoutName(layout) << LayoutBench::bytesPerOrder(layout)
+                      << " B/order, " << LayoutBench::bytesPerOrder(layout) * count / (1024 * 1024) << " MiB\n";
+
+        for (size_t run = 0; run < record.repeat; ++run) {
+            if (record.repeat > 1) std::cout << "--- run " << run + 1 << "/" << record.repeat << " ---\n";
+            std::cout << std::left << std::setw(11) << "layout" << std::setw(15) << "workload" << std::setw(12) << "Morders/s"
+                      << std::setw(10) << "ns/order" << std::setw(14) << "traffic GB/s" << std::setw(15) << "LLC miss/order"
+                      << std::setw(14) << "miss GB/s" << "checksum\n";
+
+            std::vector<LayoutResult> reference;
+            for (OrderLayout layout : layouts) {
+                std::vector<LayoutResult> results = LayoutBench::run(layout, corpus.messages(), corpus.messageSize(),
+                                                                     count, lookups, PASSES);
+                if (reference.empty()) reference = results;
+                for (size_t i = 0; i < results.size(); ++i) {
+                    const LayoutResult& r = results[i];
+                    bool matches = i < reference.size() && reference[i].checksum == r.checksum;
+                    std::string misses = "-", missBandwidth = "-";
+                    if (r.counters.valid && r.items) {
+                        std::ostringstream m, b;
+                        m << double(r.counters.cacheMisses) / r.items;
+                        b << perSecond(r.counters.cacheMisses * 64.0, r.seconds) / 1e9;
+                        misses = m.str();
+                        missBandwidth = b.str();
+                    }
+                    std::cout << std::left << std::setw(11) << orderLayoutName(layout)
+                              << std::setw(15) << layoutWorkloadName(r.workload)
+                              << std::setw(12) << perSecond(r.items, r.seconds) / 1e6
+                              << std::setw(10) << (r.items ? r.seconds * 1e9 / r.items : 0.0)
+                              << std::setw(14) << perSecond(r.traffic, r.seconds) / 1e9
+                              << std::setw(15) << misses << std::setw(14) << missBandwidth
+                              << (matches ? "ok" : "MISMATCH") << "\n";
+
+                    BenchmarkRecord result = BenchmarkRecord::make(std::string("layout/") + orderLayoutName(layout) + "/"
+                                                                   + layoutWorkloadName(r.workload) + "/" + source, r.items);
+                    result.addMetric("throughput", perSecond(r.items, r.seconds));
+                    result.addMetric("traffic_gbps", perSecond(r.traffic, r.seconds) / 1e9);
+                    result.addCounters(r.counters);
+                    saveRecord(record, result);
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
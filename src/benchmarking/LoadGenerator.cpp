@@ -0,0 +1,213 @@
+#include <LoadGenerator.h>
+#include <MessageBuilder.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+LoadGenerator::LoadGenerator(const Scenario& scenario)
+    : scenario_(scenario), rng_(scenario.seed) {
+    if (scenario.symbols == 0 || scenario.minQuantity > scenario.maxQuantity || scenario.tickSize <= 0.0)
+        throw std::invalid_argument("Scenario needs symbols > 0, minQuantity <= maxQuantity and tickSize > 0");
+
+    zipfCdf_.resize(scenario.symbols);
+    double total = 0.0;
+    for (uint32_t k = 0; k < scenario.symbols; ++k) {
+        total += 1.0 / std::pow(double(k + 1), scenario.zipfExponent);
+        zipfCdf_[k] = total;
+    }
+    for (double& c : zipfCdf_) c /= total;
+
+    // Tickers in bijective base 26 from "AA", so lengths vary with the universe
+    symbolNames_.assign(size_t(scenario.symbols) * 8, '\0');
+    for (uint32_t k = 0; k < scenario.symbols; ++k) {
+        char reversed[8];
+        size_t len = 0;
+        for (uint64_t n = uint64_t(k) + 27; n > 0 && len < 7; n = (n - 1) / 26)
+            reversed[len++] = static_cast<char>('A' + (n - 1) % 26);
+        for (size_t i = 0; i < len; ++i) symbolNames_[size_t(k) * 8 + i] = reversed[len - 1 - i];
+    }
+
+    mids_.resize(scenario.symbols);
+    for (double& mid : mids_)
+        mid = std::max(scenario.tickSize, std::round(scenario.midPrice * (0.5 + uniform()) / scenario.tickSize) * scenario.tickSize);
+
+    recent_.reserve(RECENT_ORDERS);
+}
+
+// splitmix64: fixed sequence for a seed on every platform, unlike <random> distributions
+uint64_t LoadGenerator::nextRandom() {
+    uint64_t z = (rng_ += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+double LoadGenerator::uniform() {
+    return double(nextRandom() >> 11) * 0x1.0p-53;
+}
+
+uint64_t LoadGenerator::below(uint64_t bound) {
+    return std::min(static_cast<uint64_t>(uniform() * double(bound)), bound - 1);
+}
+
+uint32_t LoadGenerator::pickSymbol() {
+    auto it = std::upper_bound(zipfCdf_.begin(), zipfCdf_.end(), uniform());
+    return static_cast<uint32_t>(std::min<size_t>(it - zipfCdf_.begin(), zipfCdf_.size() - 1));
+}
+
+// Limits rest away from mid, stops trigger beyond it; everything stays >= one tick
+double LoadGenerator::priceFor(uint32_t symbol, Side side, OrderType type) {
+    double mid = mids_[symbol];
+    double offset = double(below(scenario_.maxOffsetTicks + 1)) * scenario_.tickSize;
+    double price = mid;
+    if (type == OrderType::Limit) price = side == Side::Buy ? mid - offset : mid + offset;
+    else if (type == OrderType::Stop) price = side == Side::Buy ? mid + offset : mid - offset;
+    return std::max(price, scenario_.tickSize);
+}
+
+Order LoadGenerator::next() {
+    const Scenario& s = scenario_;
+    uint32_t quantity = s.minQuantity + static_cast<uint32_t>(below(uint64_t(s.maxQuantity - s.minQuantity) + 1));
+    Order o;
+
+    double r = uniform();
+    if (!recent_.empty() && r < s.cancelRatio + s.replaceRatio) {
+        const LiveRef& ref = recent_[below(recent_.size())];
+        bool cancel = r < s.cancelRatio;
+        o = MessageBuilder::makeTestOrder(ref.orderId, timestamp_, priceFor(ref.symbol, ref.side, ref.type),
+                                          cancel ? 0 : quantity, &symbolNames_[size_t(ref.symbol) * 8], ref.side, ref.type);
+        if (cancel) ++cancels_;
+        else ++replaces_;
+    } else if (!recent_.empty() && r < s.cancelRatio + s.replaceRatio + s.replayRatio) {
+        const LiveRef& ref = recent_[below(recent_.size())];
+        o = MessageBuilder::makeTestOrder(ref.orderId, timestamp_, ref.price, ref.quantity,
+                                          &symbolNames_[size_t(ref.symbol) * 8], ref.side, ref.type);
+        ++replays_;
+    } else {
+        uint32_t symbol = pickSymbol();
+        int64_t step = int64_t(below(2 * uint64_t(s.maxStepTicks) + 1)) - int64_t(s.maxStepTicks);
+        mids_[symbol] = std::max(s.tickSize, mids_[symbol] + double(step) * s.tickSize);
+
+        Side side = uniform() < s.buyRatio ? Side::Buy : Side::Sell;
+        double t = uniform();
+        OrderType type = t < s.marketRatio ? OrderType::Market
+                       : t < s.marketRatio + s.stopRatio ? OrderType::Stop
+                       : OrderType::Limit;
+
+        uint64_t id = nextOrderId_++;
+        double price = priceFor(symbol, side, type);
+        o = MessageBuilder::makeTestOrder(id, timestamp_, price, quantity, &symbolNames_[size_t(symbol) * 8], side, type);
+        LiveRef ref{id, symbol, side, type, price, quantity};
+        if (recent_.size() < RECENT_ORDERS) recent_.push_back(ref);
+        else recent_[id % RECENT_ORDERS] = ref;
+    }
+
+    if (s.sessions > 1) session_ = uniform() < s.runawayShare ? 0 : 1 + static_cast<uint32_t>(below(s.sessions - 1));
+
+    ++generated_;
+    timestamp_ += s.interarrivalNs;
+    if (s.burstLength && generated_ % s.burstLength == 0 && !done()) {
+        pendingPause_ = s.quietNs;
+        timestamp_ += s.quietNs;
+    }
+    return o;
+}
+
+bool LoadGenerator::done() const {
+    return generated_ >= scenario_.messages;
+}
+
+uint64_t LoadGenerator::takePause() {
+    uint64_t pause = pendingPause_;
+    pendingPause_ = 0;
+    return pause;
+}
+
+const Scenario& LoadGenerator::scenario() const {
+    return scenario_;
+}
+
+uint64_t LoadGenerator::generated() const {
+    return generated_;
+}
+
+uint64_t LoadGenerator::cancels() const {
+    return cancels_;
+}
+
+uint64_t LoadGenerator::replaces() const {
+    return replaces_;
+}
+
+uint64_t LoadGenerator::replays() const {
+    return replays_;
+}
+
+uint32_t LoadGenerator::session() const {
+    return session_;
+}
+
+std::vector<Scenario> LoadGenerator::defaultScenarios() {
+    std::vector<Scenario> scenarios;
+
+    // The old hardcoded loop: one symbol, buy market orders only
+    Scenario single;
+    single.name = "single-symbol";
+    single.messages = 2'000'000;
+    single.buyRatio = 1.0;
+    single.marketRatio = 1.0;
+    single.stopRatio = 0.0;
+    single.maxStepTicks = 1;
+    scenarios.push_back(single);
+
+    Scenario zipf;
+    zipf.name = "zipf-universe";
+    zipf.messages = 2'000'000;
+    zipf.seed = 2;
+    zipf.symbols = 5'000;
+    zipf.zipfExponent = 1.1;
+    scenarios.push_back(zipf);
+
+    Scenario amend;
+    amend.name = "amend-heavy";
+    amend.messages = 2'000'000;
+    amend.seed = 3;
+    amend.symbols = 500;
+    amend.zipfExponent = 0.8;
+    amend.cancelRatio = 0.2;
+    amend.replaceRatio = 0.3;
+    scenarios.push_back(amend);
+
+    Scenario bursty;
+    bursty.name = "bursty";
+    bursty.messages = 2'000'000;
+    bursty.seed = 4;
+    bursty.symbols = 2'000;
+    bursty.zipfExponent = 1.0;
+    bursty.burstLength = 2'000;
+    bursty.quietNs = 200'000;
+    scenarios.push_back(bursty);
+
+    // One sender at 600k msgs/s against a 100k/s session limit, seven well under it
+    Scenario runaway;
+    runaway.name = "runaway-session";
+    runaway.messages = 2'000'000;
+    runaway.seed = 5;
+    runaway.symbols = 1'000;
+    runaway.zipfExponent = 1.0;
+    runaway.sessions = 8;
+    runaway.runawayShare = 0.6;
+    scenarios.push_back(runaway);
+
+    // 2% of messages retransmit a recent order unchanged, as a gateway replay would
+    Scenario replayed;
+    replayed.name = "replayed-ids";
+    replayed.messages = 2'000'000;
+    replayed.seed = 7;
+    replayed.symbols = 1'000;
+    replayed.zipfExponent = 1.0;
+    replayed.replayRatio = 0.02;
+    scenarios.push_back(replayed);
+
+    return scenarios;
+}
@@ -0,0 +1,122 @@
+#include <ModeSupport.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+double perSecond(double amount, double seconds) {
+    return seconds > 0.0 ? amount / seconds : 0.0;
+}
+
+std::optional<SinkKind> takeSinkOption(std::vector<std::string>& args) {
+    auto it = std::find(args.begin(), args.end(), "--sink");
+    if (it == args.end()) return SinkKind::Discard;
+    if (it + 1 == args.end()) return std::nullopt;
+    auto kind = parseSinkKind(*(it + 1));
+    args.erase(it, it + 2);
+    return kind;
+}
+
+bool takeValueOption(std::vector<std::string>& args, const std::string& flag, std::string& value) {
+    auto it = std::find(args.begin(), args.end(), flag);
+    if (it == args.end()) return true;
+    if (it + 1 == args.end()) return false;
+    value = *(it + 1);
+    args.erase(it, it + 2);
+    return true;
+}
+
+bool takeFlag(std::vector<std::string>& args, const std::string& flag) {
+    auto it = std::find(args.begin(), args.end(), flag);
+    if (it == args.end()) return false;
+    args.erase(it);
+    return true;
+}
+
+bool takeRecordOptions(std::vector<std::string>& args, RecordOptions& options) {
+    std::string repeat;
+    if (!takeValueOption(args, "--record", options.path) || !takeValueOption(args, "--repeat", repeat)) return false;
+    if (!repeat.empty()) options.repeat = std::strtoull(repeat.c_str(), nullptr, 10);
+    return options.repeat > 0;
+}
+
+void printCounters(const PerfReading& reading, uint64_t messages) {
+    if (!reading.valid || messages == 0 || reading.cycles == 0) return;
+    std::cout << "Per message: " << double(reading.cycles) / messages << " cycles, "
+              << double(reading.instructions) / messages << " instructions (IPC "
+              << double(reading.instructions) / reading.cycles << "), "
+              << double(reading.cacheMisses) / messages << " cache misses, "
+              << double(reading.branchMisses) / messages << " branch misses\n";
+}
+
+void saveRecord(const RecordOptions& options, const BenchmarkRecord& record) {
+    if (options.path.empty()) return;
+    if (!BenchmarkRecord::append(options.path, record))
+        std::cerr << "Failed to append to " << options.path << "\n";
+}
+
+bool takeStageOptions(std::vector<std::string>& args, StageOptions& options) {
+    options.dedup = takeFlag(args, "--dedup");
+    options.risk = takeFlag(args, "--risk");
+    return takeValueOption(args, "--secmaster", options.secmasterPath);
+}
+
+const SecurityMaster* loadSecurityMaster(StageOptions& options) {
+    if (options.secmasterPath.empty()) return nullptr;
+    options.secmaster.emplace(options.secmasterPath);
+    return &*options.secmaster;
+}
+
+RiskLimits benchRiskLimits(const SecurityMaster* master) {
+    RiskLimits limits;
+    const size_t instruments = master ? std::max<size_t>(master->size(), 1) : 1;
+    limits.instruments.assign(instruments, InstrumentLimits{900, 0.01, 1'000.0, 500'000.0, 250'000});
+    for (uint32_t id = 0; master && id < master->size(); ++id) {
+        const InstrumentRef& ref = master->instrument(id);
+        InstrumentLimits& il = limits.instruments[id];
+        il.minPrice = ref.minPrice;
+        il.maxPrice = ref.maxPrice;
+        il.tickSize = ref.tickSize;
+        il.lotSize = ref.lotSize;
+    }
+    limits.accounts.assign(1, AccountLimits{950, 750'000.0, 1e15});
+    return limits;
+}
+
+uint32_t riskInstrument(const Order& order) {
+    return order.instrument_id == Order::NO_INSTRUMENT ? 0 : order.instrument_id;
+}
+
+DuplicateDetector benchDuplicateDetector(uint64_t messages) {
+    const size_t ids = static_cast<size_t>(std::max<uint64_t>(messages, 1));
+    return DuplicateDetector(ids, ids);
+}
+
+void printDuplicateCounters(const DuplicateDetector& dedup) {
+    std::cout << "Dedup: " << dedup.duplicates() << " duplicates dropped, " << dedup.bloomPositives()
+              << " bloom positives, " << dedup.untracked() << " untracked\n";
+}
+
+void printRiskCounters(const RiskChecker& risk) {
+    std::cout << "Risk: " << risk.checked() << " checked, " << risk.rejected() << " rejected";
+    for (size_t r = 0; r < static_cast<size_t>(RiskReject::Count); ++r)
+        if (uint64_t n = risk.rejectCount(static_cast<RiskReject>(r))) std::cout << ", " << riskRejectName(static_cast<RiskReject>(r)) << " " << n;
+    std::cout << "\n";
+}
+
+TuningProfile g_tuningProfile;
+bool g_strictTuning = false;
+
+bool tuningAllows(std::vector<unsigned> cpus) {
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    std::ostringstream differences;
+    size_t failures = PlatformCheck::report(PlatformCheck::run(g_tuningProfile, cpus), differences, false);
+    if (failures == 0) return true;
+    const std::string list = PlatformCheck::formatCpuList(cpus);
+    std::cerr << "Platform check, " << (cpus.size() == 1 ? "cpu " : "cpus ") << list << ": " << failures << (failures == 1 ? " difference" : " differences")
+              << " from the tuning profile (details: platform --cpus " << list << ")\n" << differences.str();
+    if (!g_strictTuning) return true;
+    std::cerr << "Refusing to run with --strict-tuning\n";
+    return false;
+}
@@ -0,0 +1,131 @@
+#include <PingPong.h>
+#include <Clock.h>
+#include <Order.h>
+#include <ThreadAffinity.h>
+#include <templates/spsc_queue/SPSCQueue.h>
+#include <templates/locked_queue/LockedQueue.h>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+template <size_t Bytes>
+struct Payload {
+    uint64_t stamp;
+    uint8_t body[Bytes - sizeof(uint64_t)];
+};
+
+template <>
+struct Payload<8> {
+    uint64_t stamp;
+};
+
+template <size_t Bytes>
+void setStamp(Payload<Bytes>& p, uint64_t stamp) { p.stamp = stamp; }
+template <size_t Bytes>
+uint64_t getStamp(const Payload<Bytes>& p) { return p.stamp; }
+void setStamp(Order& o, uint64_t stamp) { o.timestamp_ns = stamp; }
+uint64_t getStamp(const Order& o) { return o.timestamp_ns; }
+
+constexpr size_t QUEUE_CAPACITY = 64;
+
+// Two threads on one CPU must yield or each spin burns a whole time slice
+template <typename Queue, typename T>
+void waitPop(Queue& queue, T& item, bool yield) {
+    if constexpr (requires { queue.popWait(item); }) {
+        if (!yield) {
+            queue.popWait(item);
+            return;
+        }
+    }
+    while (!queue.pop(item))
+        if (yield) std::this_thread::yield();
+}
+
+template <typename Queue, typename T>
+void waitPush(Queue& queue, const T& item, bool yield) {
+    while (!queue.push(item))
+        if (yield) std::this_thread::yield();
+}
+
+template <typename Queue, typename T>
+PingPongResult bounce(unsigned cpuA, unsigned cpuB, size_t iterations, size_t warmup) {
+    Queue toB(QUEUE_CAPACITY);
+    Queue toA(QUEUE_CAPACITY);
+    PingPongResult result;
+    const bool yield = cpuA == cpuB;
+    const size_t total = warmup + iterations;
+    std::atomic<bool> ready{false};
+
+    std::thread echo([&] {
+        ThreadAffinity::pinCurrentThread(cpuB);
+        ready.store(true, std::memory_order_release);
+        T item;
+        for (size_t i = 0; i < total; ++i) {
+            waitPop(toB, item, yield);
+            uint64_t now = EngineClock::now();
+            if (i >= warmup) result.oneWay.record(static_cast<uint64_t>(ticksToNanos(now - getStamp(item))));
+            waitPush(toA, item, yield);
+        }
+    });
+
+    std::thread sender([&] {
+        ThreadAffinity::pinCurrentThread(cpuA);
+        while (!ready.load(std::memory_order_acquire)) std::this_thread::yield();
+
+        T item{};
+        for (size_t i = 0; i < total; ++i) {
+            uint64_t start = EngineClock::now();
+            setStamp(item, start);
+            waitPush(toB, item, yield);
+            waitPop(toA, item, yield);
+            uint64_t end = EngineClock::now();
+            if (i >= warmup) result.roundTrip.record(static_cast<uint64_t>(ticksToNanos(end - start)));
+        }
+    });
+    sender.join();
+    echo.join();
+    return result;
+}
+
+template <typename T>
+PingPongResult bounceWith(HandoffQueue queue, unsigned cpuA, unsigned cpuB, size_t iterations, size_t warmup) {
+    using lockedqueue::LockedQueue;
+    using lockedqueue::WaitPolicy;
+    switch (queue) {
+        case HandoffQueue::SPSC:
+            return bounce<spscqueue::SPSCQueue<T>, T>(cpuA, cpuB, iterations, warmup);
+        case HandoffQueue::MutexCondVar:
+            return bounce<LockedQueue<T, WaitPolicy::CondVar>, T>(cpuA, cpuB, iterations, warmup);
+        case HandoffQueue::MutexSpin:
+            return bounce<LockedQueue<T, WaitPolicy::Spin>, T>(cpuA, cpuB, iterations, warmup);
+    }
+    throw std::invalid_argument("Unknown handoff queue");
+}
+
+} // namespace
+
+const char* handoffQueueName(HandoffQueue queue) {
+    switch (queue) {
+        case HandoffQueue::SPSC: return "spsc";
+        case HandoffQueue::MutexCondVar: return "mutex+condvar";
+        case HandoffQueue::MutexSpin: return "mutex+spin";
+    }
+    return "unknown";
+}
+
+bool PingPong::supportsPayload(size_t bytes) {
+    return bytes == 8 || bytes == 16 || bytes == 32 || bytes == sizeof(Order);
+}
+
+PingPongResult PingPong::run(HandoffQueue queue, size_t payloadBytes, unsigned cpuA, unsigned cpuB,
+                             size_t iterations, size_t warmup) {
+    switch (payloadBytes) {
+        case 8: return bounceWith<Payload<8>>(queue, cpuA, cpuB, iterations, warmup);
+        case 16: return bounceWith<Payload<16>>(queue, cpuA, cpuB, iterations, warmup);
+        case 32: return bounceWith<Payload<32>>(queue, cpuA, cpuB, iterations, warmup);
+        case sizeof(Order): return bounceWith<Order>(queue, cpuA, cpuB, iterations, warmup);
+    }
+    throw std::invalid_argument("Unsupported ping-pong payload size");
+}
@@ -0,0 +1,62 @@
+#include <Modes.h>
+#include <ModeSupport.h>
+#include <ThreadAffinity.h>
+#include <PingPong.h>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+// SPSCQueue vs mutex queues, one-way and round trip, between SMT siblings,
+// cores of one package and packages, for payloads from 8 bytes to an Order
+int runPingPong(int argc, char** argv) {
+    size_t iterations = argc > 0 ? std::strtoull(argv[0], nullptr, 10) : 100'000;
+    if (iterations == 0) iterations = 1;
+    size_t warmup = iterations / 10;
+
+    struct CpuPair {
+        const char* name;
+        unsigned a, b;
+    };
+    std::vector<CpuInfo> cpus = ThreadAffinity::topology();
+    std::vector<CpuPair> pairs;
+    auto addFirst = [&](const char* name, auto matches) {
+        for (size_t i = 0; i < cpus.size(); ++i)
+            for (size_t j = i + 1; j < cpus.size(); ++j)
+                if (cpus[i].package >= 0 && cpus[i].core >= 0 && matches(cpus[i], cpus[j])) {
+                    pairs.push_back({name, cpus[i].cpu, cpus[j].cpu});
+                    return;
+                }
+    };
+    addFirst("smt-siblings", [](const CpuInfo& x, const CpuInfo& y) { return x.package == y.package && x.core == y.core; });
+    addFirst("cross-core", [](const CpuInfo& x, const CpuInfo& y) { return x.package == y.package && x.core != y.core; });
+    addFirst("cross-socket", [](const CpuInfo& x, const CpuInfo& y) { return x.package != y.package; });
+    if (pairs.empty()) {
+        if (cpus.size() > 1) pairs.push_back({"cross-cpu", cpus[0].cpu, cpus[1].cpu});
+        else pairs.push_back({"same-cpu", cpus[0].cpu, cpus[0].cpu});
+    }
+    std::vector<unsigned> pinned;
+    for (const CpuPair& pair : pairs) pinned.insert(pinned.end(), {pair.a, pair.b});
+    if (!tuningAllows(pinned)) return 1;
+
+    const HandoffQueue queues[] = {HandoffQueue::SPSC, HandoffQueue::MutexCondVar, HandoffQueue::MutexSpin};
+    const size_t payloads[] = {8, 16, 32, sizeof(Order)};
+
+    std::cout << "=== Ping-pong: " << iterations << " round trips per run (ns) ===\n";
+    std::cout << std::left << std::setw(14) << "cpus" << std::setw(15) << "queue" << std::setw(7) << "bytes"
+              << "one-way p50/p99/p99.9/max         round-trip p50/p99/p99.9\n";
+    for (const CpuPair& pair : pairs) {
+        std::string cpuLabel = pair.name + std::string(" ") + std::to_string(pair.a) + "," + std::to_string(pair.b);
+        for (HandoffQueue queue : queues) {
+            for (size_t bytes : payloads) {
+                PingPongResult r = PingPong::run(queue, bytes, pair.a, pair.b, iterations, warmup);
+                std::string oneWay = std::to_string(r.oneWay.percentile(50)) + "/" + std::to_string(r.oneWay.percentile(99))
+                    + "/" + std::to_string(r.oneWay.percentile(99.9)) + "/" + std::to_string(r.oneWay.max());
+                std::cout << std::left << std::setw(14) << cpuLabel << std::setw(15) << handoffQueueName(queue)
+                          << std::setw(7) << bytes << std::setw(34) << oneWay
+                          << r.roundTrip.percentile(50) << "/" << r.roundTrip.percentile(99) << "/"
+                          << r.roundTrip.percentile(99.9) << "\n";
+            }
+        }
+    }
+    return 0;
+}
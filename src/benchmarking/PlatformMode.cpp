@@ -0,0 +1,20 @@
+#include <Modes.h>
+#include <ModeSupport.h>
+#include <ThreadAffinity.h>
+#include <iostream>
+
+// Full tuning report for the given cpus (default: every cpu we may run on)
+int checkPlatform(int argc, char** argv) {
+    std::vector<std::string> args(argv, argv + argc);
+    std::string cpuList;
+    if (!takeValueOption(args, "--cpus", cpuList) || !args.empty()) {
+        std::cerr << "Usage: platform [--cpus 2-5,8] [--tuning-profile <file>] [--strict-tuning]\n";
+        return 1;
+    }
+    std::vector<unsigned> cpus = cpuList.empty() ? ThreadAffinity::allowedCpus() : PlatformCheck::parseCpuList(cpuList);
+
+    std::cout << "=== Platform tuning, cpus " << PlatformCheck::formatCpuList(cpus) << " ===\n";
+    size_t failures = PlatformCheck::report(PlatformCheck::run(g_tuningProfile, cpus), std::cout, true);
+    std::cout << failures << (failures == 1 ? " difference" : " differences") << " from the tuning profile\n";
+    return g_strictTuning && failures ? 1 : 0;
+}
@@ -0,0 +1,46 @@
+#include <ResultSink.h>
+#include <stdexcept>
+
+std::optional<SinkKind> parseSinkKind(const std::string& name) {
+    if (name == "discard") return SinkKind::Discard;
+    if (name == "ring") return SinkKind::Ring;
+    if (name == "queue") return SinkKind::Queue;
+    return std::nullopt;
+}
+
+const char* sinkName(SinkKind kind) {
+    switch (kind) {
+        case SinkKind::Discard: return "discard";
+        case SinkKind::Ring: return "ring";
+        case SinkKind::Queue: return "queue";
+    }
+    return "unknown";
+}
+
+RingSink::RingSink(size_t capacity) : ring_(capacity), mask_(capacity - 1) {
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+        throw std::invalid_argument("RingSink capacity must be a power of 2");
+}
+
+QueueSink::QueueSink(size_t capacity) : queue_(capacity), consumer_([this] { drain(); }) {}
+
+QueueSink::~QueueSink() {
+    finish();
+}
+
+void QueueSink::drain() {
+    uint64_t checksum = 0;
+    Order o;
+    for (;;) {
+        bool stopping = stop_.load(std::memory_order_acquire);
+        while (queue_.pop(o)) checksum = mixOrder(checksum, o);
+        if (stopping) break;
+    }
+    checksum_.store(checksum, std::memory_order_release);
+}
+
+void QueueSink::finish() {
+    if (!consumer_.joinable()) return;
+    stop_.store(true, std::memory_order_release);
+    consumer_.join();
+}
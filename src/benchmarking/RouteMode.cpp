@@ -0,0 +1,116 @@
+#include <Modes.h>
+#include <ModeSupport.h>
+#include <Clock.h>
+#include <LoadGenerator.h>
+#include <ThreadAffinity.h>
+#include <SmartOrderRouter.h>
+#include <SimulatedVenue.h>
+#include <LatencyHistogram.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <unordered_map>
+
+// Smart order routing over N SimulatedVenues (default 16). Only route() is
+// timed; the venues match, ack and requote every 64 decisions, outside it.
+int routeBench(int argc, char** argv) {
+    std::vector<std::string> args(argv, argv + argc);
+    std::string venuesArg;
+    if (!takeValueOption(args, "--venues", venuesArg) || args.size() > 1) {
+        std::cerr << "Usage: route [decisions] [--venues n]\n";
+        return 1;
+    }
+    const uint64_t decisions = args.empty() ? 1'000'000 : std::strtoull(args[0].c_str(), nullptr, 10);
+    const size_t venueCount = venuesArg.empty() ? SmartOrderRouter::MAX_VENUES : std::strtoul(venuesArg.c_str(), nullptr, 10);
+    if (decisions == 0 || venueCount == 0 || venueCount > SmartOrderRouter::MAX_VENUES) {
+        std::cerr << "route needs decisions > 0 and 1.." << SmartOrderRouter::MAX_VENUES << " venues\n";
+        return 1;
+    }
+    constexpr uint32_t INSTRUMENTS = 64;
+
+    // Parents from a fixed-mid scenario; instrument ids by first appearance,
+    // venues quote around each instrument's first price
+    Scenario scenario;
+    scenario.name = "route";
+    scenario.messages = decisions;
+    scenario.seed = 6;
+    scenario.symbols = INSTRUMENTS;
+    scenario.maxStepTicks = 0;
+    LoadGenerator generator(scenario);
+    std::vector<Order> parents;
+    parents.reserve(decisions);
+    std::unordered_map<std::string, uint32_t> ids;
+    std::vector<double> reference;
+    while (!generator.done()) {
+        Order o = generator.next();
+        auto [it, added] = ids.try_emplace(std::string(o.symbol, strnlen(o.symbol, sizeof(o.symbol))),
+                                           static_cast<uint32_t>(ids.size()));
+        if (added) reference.push_back(o.price);
+        o.instrument_id = it->second;
+        parents.push_back(o);
+    }
+
+    // Fees from a 0.2c rebate to a 0.3c take fee, acks 20 us apart to 95 us, 1-3 tick half spreads
+    SmartOrderRouter router(INSTRUMENTS, 0.0002 / double(nanosToTicks(1'000)));
+    std::vector<std::unique_ptr<SimulatedVenue>> venues;
+    for (size_t v = 0; v < venueCount; ++v) {
+        venues.push_back(std::make_unique<SimulatedVenue>(router, VenueConfig{0.001 * double(v % 6) - 0.002}, INSTRUMENTS, 4096,
+                                                          nanosToTicks(20'000 + 5'000 * v), nanosToTicks(2'000), v + 1));
+        const double halfSpread = scenario.tickSize * double(1 + v % 3);
+        const uint32_t size = 100 + 25 * static_cast<uint32_t>(v);
+        for (uint32_t i = 0; i < reference.size(); ++i)
+            venues.back()->setQuote(i, VenueQuote{reference[i] - halfSpread, reference[i] + halfSpread, size, size});
+    }
+
+    const unsigned cpu = ThreadAffinity::allowedCpus()[0];
+    if (!tuningAllows({cpu})) return 1;
+    ThreadAffinity::pinCurrentThread(cpu);
+    LatencyHistogram clockPair, latency, single, sweep;
+    for (int i = 0; i < 100'000; ++i) {
+        uint64_t start = EngineClock::now();
+        clockPair.record(static_cast<uint64_t>(ticksToNanos(EngineClock::now() - start)));
+    }
+
+    uint64_t children = 0, routed = 0, resting = 0, unrouted = 0;
+    for (uint64_t i = 0; i < parents.size(); ++i) {
+        uint64_t start = EngineClock::now();
+        RouteResult r = router.route(parents[i], start);
+        uint64_t end = EngineClock::now();
+        uint64_t ns = static_cast<uint64_t>(ticksToNanos(end - start));
+        latency.record(ns);
+        (r.children > 1 ? sweep : single).record(ns);
+        children += r.children;
+        routed += r.routedQty;
+        resting += r.restingQty;
+        unrouted += r.unroutedQty;
+        if ((i & 63) == 63)
+            for (auto& venue : venues) venue->poll(end);
+    }
+    for (auto& venue : venues) venue->poll(EngineClock::now());
+
+    std::cout << "=== Route: " << decisions << " decisions over " << venueCount << " venues, " << reference.size()
+              << " instruments ===\n";
+    std::cout << "Children: " << children << " (" << double(children) / decisions << " per decision), quantity routed "
+              << routed << ", resting " << resting << ", unrouted " << unrouted << "\n";
+    std::cout << "Decision ns (each includes a clock read pair, p50 " << clockPair.percentile(50) << " ns):\n";
+    auto printLatency = [](const char* label, const LatencyHistogram& h) {
+        if (!h.count()) return;
+        std::cout << "  " << std::left << std::setw(16) << label << h.count() << " decisions: p50 " << h.percentile(50)
+                  << ", p90 " << h.percentile(90) << ", p99 " << h.percentile(99) << ", p99.9 " << h.percentile(99.9)
+                  << ", max " << h.max() << "\n";
+    };
+    printLatency("all", latency);
+    printLatency("one child", single);
+    printLatency("sweep (2+)", sweep);
+    std::cout << "venue  fee      received  filled     ack EWMA us\n";
+    for (size_t v = 0; v < venues.size(); ++v) {
+        const SimulatedVenue& venue = *venues[v];
+        std::cout << std::left << std::setw(7) << v << std::setw(9) << 0.001 * double(v % 6) - 0.002
+                  << std::setw(10) << venue.ordersReceived() << std::setw(11) << venue.filledQty()
+                  << ticksToNanos(router.latencyEstimate(venue.id())) / 1e3 << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <Modes.h>
+#include <ModeSupport.h>
+#include <Clock.h>
+#include <MessageParser.h>
+#include <Corpus.h>
+#include <ThreadAffinity.h>
+#include <LatencyHistogram.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+struct alignas(64) ScaleResult {
+    double seconds = 0.0;
+    uint64_t messages = 0;
+    uint64_t accepted = 0;
+    uint64_t checksum = 0;
+    bool pinned = false;
+    LatencyHistogram latency;   // ns
+};
+
+// N independent parsers on N pinned threads over disjoint corpus slices,
+// for N = 1..maxThreads. A flat efficiency curve points at shared state in
+// the parse path or at memory bandwidth. Every thread count gets one summary
+// line per thread; the largest also prints each thread's latency histogram.
+int scaleCorpus(int argc, char** argv) {
+    std::vector<std::string> args(argv, argv + argc);
+    StageOptions stages;
+    if (!takeStageOptions(args, stages) || stages.dedup || stages.risk || args.empty() || args.size() > 2) {
+        std::cerr << "Usage: scale <corpus> [maxThreads] [--secmaster <file>]\n";
+        return 1;
+    }
+
+    try {
+        Corpus corpus(args[0]);
+        const uint8_t* data = corpus.messages();
+        const size_t size = corpus.messageSize();
+        const uint64_t count = corpus.count();
+        const SecurityMaster* master = loadSecurityMaster(stages);
+
+        std::vector<unsigned> cpus = ThreadAffinity::allowedCpus();
+        size_t maxThreads = args.size() > 1 ? std::strtoul(args[1].c_str(), nullptr, 10) : cpus.size();
+        if (maxThreads == 0) maxThreads = 1;
+        if (maxThreads > cpus.size()) {
+            std::cout << "Only " << cpus.size() << " CPUs allowed: stopping at " << cpus.size()
+                      << " threads so no two parsers share a core\n";
+            maxThreads = cpus.size();
+        }
+        if (maxThreads > count) {
+            std::cout << "Only " << count << " messages: stopping at " << count << " threads so no slice is empty\n";
+            maxThreads = static_cast<size_t>(std::max<uint64_t>(count, 1));
+        }
+        if (!tuningAllows({cpus.begin(), cpus.begin() + maxThreads})) return 1;
+
+        std::cout << "=== Scaling: " << args[0] << " (" << count << " messages, "
+                  << cpus.size() << " CPUs available" << (master ? ", security master " + stages.secmasterPath : "")
+                  << ") ===\n";
+        std::cout << "threads  msgs/sec        efficiency\n";
+
+        double baseline = 0.0;
+        for (size_t n = 1; n <= maxThreads; ++n) {
+            std::vector<ScaleResult> results(n);
+            std::atomic<size_t> ready{0};
+            std::atomic<bool> go{false};
+            std::vector<std::thread> threads;
+
+            for (size_t t = 0; t < n; ++t) {
+                threads.emplace_back([&, t] {
+                    ScaleResult& r = results[t];
+                    r.pinned = ThreadAffinity::pinCurrentThread(cpus[t]);
+                    MessageParser parser;
+                    parser.setSecurityMaster(master);
+                    DiscardSink sink;
+                    MessageParser::resetLatency();
+                    uint64_t begin = count * t / n;
+                    uint64_t end = count * (t + 1) / n;
+                    r.messages = end - begin;
+
+                    ready.fetch_add(1, std::memory_order_release);
+                    while (!go.load(std::memory_order_acquire)) {}
+
+                    uint64_t start = EngineClock::now();
+                    for (uint64_t i = begin; i < end; ++i) {
+                        auto parsedOrder = parser.parse(data + i * size, size);
+                        if (parsedOrder) sink.consume(*parsedOrder);
+                    }
+                    r.seconds = ticksToNanos(EngineClock::now() - start) / 1e9;
+                    r.accepted = sink.count();
+                    r.checksum = sink.checksum();
+                    const uint64_t* samples = parser.getTimestampList();
+                    for (uint64_t i = 0, k = std::min<uint64_t>(parser.getIndex(), MessageParser::MAX_SAMPLES); i < k; ++i)
+                        r.latency.record(static_cast<uint64_t>(ticksToNanos(samples[i])));
+                });
+            }
+
+            while (ready.load(std::memory_order_acquire) < n) {}
+            uint64_t start = EngineClock::now();
+            go.store(true, std::memory_order_release);
+            for (std::thread& thread : threads) thread.join();
+            double wall = ticksToNanos(EngineClock::now() - start) / 1e9;
+
+            double throughput = perSecond(count, wall);
+            if (n == 1) baseline = throughput;
+            std::cout << std::left << std::setw(9) << n << std::setw(16) << throughput
+                      << std::fixed << std::setprecision(2) << perSecond(throughput, n * baseline)
+                      << std::defaultfloat << std::setprecision(6) << "\n";
+            for (size_t t = 0; t < n; ++t) {
+                const ScaleResult& r = results[t];
+                std::cout << "  thread " << t << " cpu " << cpus[t] << (r.pinned ? "" : " (unpinned)") << ": ";
+                if (r.messages == 0 || r.seconds <= 0.0) {
+                    std::cout << "empty slice\n";
+                    continue;
+                }
+                std::cout << perSecond(r.accepted, r.seconds) << " msgs/sec, p50 " << r.latency.percentile(50)
+                          << " ns, p99 " << r.latency.percentile(99) << " ns, p99.9 " << r.latency.percentile(99.9)
+                          << " ns, max " << r.latency.max() << " ns\n";
+                if (n == maxThreads) r.latency.print(std::cout, "    ");
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include <Modes.h>
+#include <ModeSupport.h>
+#include <Clock.h>
+#include <MessageParser.h>
+#include <WireOrder.h>
+#include <LatencyTracker.h>
+#include <LoadGenerator.h>
+#include <ThreadAffinity.h>
+#include <Throttle.h>
+#include <algorithm>
+#include <iostream>
+
+// Quiet phases idle outside the timed window (simulated time just jumps)
+static void idleFor(uint64_t ns) {
+    if constexpr (EngineClock::simulated) {
+        SimClock::advance(ns);
+    } else {
+        uint64_t until = EngineClock::now() + nanosToTicks(ns);
+        while (EngineClock::now() < until) {}
+    }
+}
+
+// "/dedup/risk" style suffix naming the stages a record ran with
+static std::string stageSuffix(const StageOptions& stages) {
+    return std::string(stages.dedup ? "/dedup" : "") + (stages.risk ? "/risk" : "");
+}
+
+template <typename Sink>
+static void runScenario(const Scenario& scenario, Sink& sink, SinkKind kind, const StageOptions& stages, const RecordOptions& record) {
+    MessageParser parser;
+    LatencyTracker benchmarker;
+    LoadGenerator generator(scenario);
+    PerfCounters counters;
+    const bool risk = stages.risk;
+    if (stages.secmaster) parser.setSecurityMaster(&*stages.secmaster);
+    RiskLimits limits = benchRiskLimits(stages.secmaster ? &*stages.secmaster : nullptr);
+    RiskChecker checker(limits);
+    std::optional<DuplicateDetector> dedup;
+    if (stages.dedup) dedup.emplace(benchDuplicateDetector(scenario.messages));
+    // Multi-session scenarios pay the throttle on the raw message, each session as its own account,
+    // at the scenario's send times
+    std::optional<Throttle> throttle;
+    if (scenario.sessions > 0) throttle.emplace(ThrottleConfig{}, scenario.sessions, scenario.sessions);
+    MessageParser::resetLatency();
+
+    uint8_t buffer[sizeof(WireOrder)];
+    uint64_t rejected = 0;
+    uint64_t throttled = 0;
+    uint64_t busyTicks = 0;
+    if constexpr (EngineClock::simulated) SimClock::set(0);     // generator stamps start at 0
+    counters.start();
+    uint64_t start = EngineClock::now();
+
+    while (!generator.done()) {
+        if (uint64_t pause = generator.takePause()) {
+            busyTicks += EngineClock::now() - start;
+            counters.pause();
+            idleFor(pause);
+            counters.resume();
+            start = EngineClock::now();
+        }
+
+        Order o = generator.next();
+        // A replay build runs on the scenario's own send times
+        if constexpr (EngineClock::simulated) SimClock::set(o.timestamp_ns);
+        parser.serializeTo(o, buffer);
+        if (throttle && !throttle->admitRaw(generator.session(), generator.session(), buffer, sizeof(buffer),
+                                            nanosToTicks(o.timestamp_ns))) {
+            ++throttled;
+            continue;
+        }
+        auto parsedOrder = parser.parse(buffer, sizeof(buffer));
+
+        if (!parsedOrder) {
+            ++rejected;
+            continue;
+        }
+        if (dedup && dedup->isDuplicate(parsedOrder->order_id)) continue;
+        if (risk && !checker.check(*parsedOrder, riskInstrument(*parsedOrder), 0).accepted) {
+            if (dedup) dedup->onOrderClosed(parsedOrder->order_id);
+            continue;
+        }
+
+        sink.consume(*parsedOrder);
+    }
+    sink.finish();
+    busyTicks += EngineClock::now() - start;
+    PerfReading reading = counters.stop();
+
+    double seconds = ticksToNanos(busyTicks) / 1e9;
+    std::cout << "\n=== Scenario: " << scenario.name << " ===\n";
+    std::cout << "Messages: " << generator.generated() << " (accepted " << sink.count()
+              << ", rejected " << rejected << ", cancels " << generator.cancels()
+              << ", replaces " << generator.replaces() << ", replays " << generator.replays() << ")\n";
+    if (throttle) {
+        std::cout << "Throttled before parse: " << throttled << " (accepted/rejected per session:";
+        for (uint32_t id = 0; id < scenario.sessions; ++id)
+            std::cout << " " << id << " " << throttle->session(id).accepted << "/" << throttle->session(id).rejected;
+        std::cout << ")\n";
+    }
+    if constexpr (EngineClock::simulated) {
+        // Parse work takes no simulated time, so there is nothing to time
+        std::cout << "Replayed " << seconds << " simulated seconds (quiet phases excluded); parse latency is not "
+                     "measured under ENGINE_CLOCK=SIM\n";
+    } else {
+        std::cout << "Parsed in " << seconds << " seconds (quiet phases excluded).\n";
+        std::cout << "Throughput: " << perSecond(generator.generated(), seconds) << " messages/sec\n";
+    }
+    std::cout << "Sink checksum: " << sink.checksum() << "\n";
+    if (dedup) printDuplicateCounters(*dedup);
+    if (risk) printRiskCounters(checker);
+    printCounters(reading, generator.generated());
+    if constexpr (EngineClock::simulated) return;
+
+    uint64_t samples = std::min<uint64_t>(parser.getIndex(), MessageParser::MAX_SAMPLES);
+    benchmarker.analyzeLatencies(parser.getTimestampList(), samples);
+
+    BenchmarkRecord result = BenchmarkRecord::make("scenario/" + scenario.name + "/" + sinkName(kind) + stageSuffix(stages),
+                                                  generator.generated());
+    result.addParseStats(seconds, parser.getTimestampList(), samples);
+    result.addCounters(reading);
+    saveRecord(record, result);
+}
+
+int runScenarios(int argc, char** argv) {
+    std::vector<Scenario> scenarios = LoadGenerator::defaultScenarios();
+    std::vector<std::string> selected(argv, argv + argc);
+    auto sinkKind = takeSinkOption(selected);
+    StageOptions stages;
+    if (!sinkKind || !takeStageOptions(selected, stages)) {
+        std::cerr << "--sink takes discard, ring or queue, --secmaster a file\n";
+        return 1;
+    }
+    RecordOptions record;
+    if (!takeRecordOptions(selected, record)) {
+        std::cerr << "--record takes a file, --repeat a positive count\n";
+        return 1;
+    }
+    try {
+        loadSecurityMaster(stages);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    if (!tuningAllows({ThreadAffinity::allowedCpus()[0]})) return 1;
+    if (EngineClock::simulated && !record.path.empty())
+        std::cout << "--record ignored: nothing is timed under ENGINE_CLOCK=SIM\n";
+    std::cout << "Sink: " << sinkName(*sinkKind) << (stages.dedup ? ", duplicate id stage after parse" : "")
+              << (stages.risk ? ", risk stage after parse" : "")
+              << (stages.secmaster ? ", security master " + stages.secmasterPath : "") << "\n";
+
+    size_t ran = 0;
+    for (const Scenario& scenario : scenarios) {
+        if (!selected.empty() && std::find(selected.begin(), selected.end(), scenario.name) == selected.end())
+            continue;
+        for (size_t run = 0; run < record.repeat; ++run)
+            withSink(*sinkKind, [&](auto& sink) { runScenario(scenario, sink, *sinkKind, stages, record); });
+        ++ran;
+    }
+
+    if (ran == 0) {
+        std::cerr << "No matching scenario. Available:";
+        for (const Scenario& scenario : scenarios) std::cerr << " " << scenario.name;
+        std::cerr << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -1,58 +1,74 @@
+#include <Modes.h>
+#include <ModeSupport.h>
+#include <Clock.h>
+#include <PlatformCheck.h>
+#include <exception>
 #include <iostream>
+#include <string>
 #include <vector>
-#include <chrono>
-#include <MessageParser.h>
-#include <MessageBuilder.h>
-#include <WireOrder.h>
-#include <LatencyTracker.h>
-#include <atomic>
-#include "../include/templates/spsc_queue/SPSCQueue.h"
-#include <thread>
 
-
-int main() {
-    
-    const int NUM_MESSAGES = 20'000'001;
-    MessageParser parser;
-    LatencyTracker benchmarker;
-    std::vector<Order> orders;
-    orders.reserve(NUM_MESSAGES);
-
-    auto start = std::chrono::high_resolution_clock::now();
-
-    for (int i = 0; i < NUM_MESSAGES; i++) {
-        Order o = MessageBuilder::makeTestOrder(
-            i,                      // order_id
-            1000 + i,               // timestamp
-            50.25 + i * 0.01,       // price
-            10 + i % 100,           // quantity
-            "AAPL",                 // symbol
-            Side::Buy,              // side
-            OrderType::Market       // ordertype
-
-        );
-
-        std::vector<uint8_t> serialized = parser.serialize(o);
-
-        // auto parsedOrder = parser.parse(reinterpret_cast<const uint8_t*>(&o), sizeof(WireOrder));
-        auto parsedOrder = parser.parse(serialized.data(), serialized.size());
-
-        if (!parsedOrder) {
-            std::cerr << "Parse failed at message " << i << "\n";
-            continue;
+int main(int argc, char** argv) {
+    // Global options, accepted anywhere on the command line
+    std::vector<char*> args(argv + 1, argv + argc);
+    try {
+        for (size_t i = 0; i < args.size();) {
+            std::string arg = args[i];
+            if (arg == "--strict-tuning") {
+                g_strictTuning = true;
+                args.erase(args.begin() + i);
+            } else if (arg == "--tuning-profile") {
+                if (i + 1 == args.size()) {
+                    std::cerr << "--tuning-profile takes a file\n";
+                    return 1;
+                }
+                g_tuningProfile = TuningProfile::load(args[i + 1]);
+                args.erase(args.begin() + i, args.begin() + i + 2);
+            } else {
+                ++i;
+            }
         }
-
-        orders.push_back(*parsedOrder);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
     }
 
-    
+    std::string mode = args.empty() ? "scenarios" : args[0];
+    int rest = args.size() > 1 ? static_cast<int>(args.size() - 1) : 0;
+    char** restArgs = args.data() + (args.empty() ? 0 : 1);
 
-    auto end = std::chrono::high_resolution_clock::now();
-    double seconds = std::chrono::duration<double>(end - start).count();
-    std::cout << "Parsed " << orders.size() << " messages in " << seconds << " seconds.\n";
-    std::cout << "Throughput: " << orders.size() / seconds << " messages/sec\n";
+    // Measuring modes check the host against the tuning profile themselves,
+    // through tuningAllows, once they know which cpus they pin to
+    if (mode == "platform") return checkPlatform(rest, restArgs);
 
-    auto& latencyArr = parser.getTimestampList();
-    benchmarker.analyzeLatencies(latencyArr, MessageParser::MAX_SAMPLES);
+    // SimClock only moves when a driver advances it, so timing real work on
+    // it reads zero; scenarios still run, replayed on their send times
+    if (EngineClock::simulated && (mode == "bench" || mode == "scale" || mode == "pingpong" || mode == "route"
+                                   || mode == "layout" || mode == "hiccup")) {
+        std::cerr << mode << " times real work and cannot run on the simulated clock; rebuild with "
+                     "-DENGINE_CLOCK=TSC or MONOTONIC\n";
+        return 1;
+    }
+    if (mode == "scenarios") return runScenarios(rest, restArgs);
+    if (mode == "corpus") return writeCorpus(rest, restArgs);
+    if (mode == "bench") return benchCorpus(rest, restArgs);
+    if (mode == "scale") return scaleCorpus(rest, restArgs);
+    if (mode == "pingpong") return runPingPong(rest, restArgs);
+    if (mode == "route") return routeBench(rest, restArgs);
+    if (mode == "layout") return layoutCorpus(rest, restArgs);
+    if (mode == "hiccup") return hiccupCorpus(rest, restArgs);
+    if (mode == "compare") return compareRecords(rest, restArgs);
 
+    std::cerr << "Usage: " << argv[0] << " [scenarios [--sink discard|ring|queue] [--dedup] [--risk] [--secmaster <file>] [--record <file>] [--repeat <n>] [name...]]\n"
+              << "       " << argv[0] << " corpus <scenario> <path> [messages]\n"
+              << "       " << argv[0] << " bench <corpus> [--sink discard|ring|queue] [--dedup] [--risk] [--secmaster <file>] [--record <file>] [--repeat <n>]\n"
+              << "       " << argv[0] << " scale <corpus> [maxThreads] [--secmaster <file>]\n"
+              << "       " << argv[0] << " pingpong [iterations]\n"
+              << "       " << argv[0] << " route [decisions] [--venues n]\n"
+              << "       " << argv[0] << " layout <corpus> [lookups] [--record <file>] [--repeat <n>]\n"
+              << "       " << argv[0] << " hiccup <corpus> [--mode thread|hook] [--threshold ns] [--cpu n] [--passes n] [--secmaster <file>]\n"
+              << "       " << argv[0] << " compare <baseline.jsonl> <candidate.jsonl> [--alpha a] [--threshold pct]\n"
+              << "       " << argv[0] << " platform [--cpus list]\n"
+              << "Any mode: --tuning-profile <file> (default: performance governor, isolcpus, nohz_full, THP never,\n"
+              << "          no IRQs, no C-state deeper than 10 us), --strict-tuning (refuse to run on differences)\n";
+    return 1;
 }
@@ -0,0 +1,94 @@
+#include <OrderIdGenerator.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include <Clock.h>
+
+namespace {
+    // Generators outlive the threads that use them: a shard handed on to a
+    // new thread keeps its last millisecond and sequence, so ids stay unique
+    std::mutex g_shardMutex;
+    std::vector<std::unique_ptr<OrderIdGenerator>> g_generators;    // index = shard
+    std::vector<OrderIdGenerator*> g_idle;                          // released by exited threads
+
+    OrderIdGenerator* acquireGenerator() {
+        std::lock_guard<std::mutex> lock(g_shardMutex);
+        if (!g_idle.empty()) {
+            OrderIdGenerator* generator = g_idle.back();
+            g_idle.pop_back();
+            return generator;
+        }
+        if (g_generators.size() == OrderIdGenerator::MAX_SHARDS)
+            throw std::runtime_error("OrderIdGenerator shards exhausted (too many live threads)");
+        g_generators.push_back(std::make_unique<OrderIdGenerator>(static_cast<uint8_t>(g_generators.size())));
+        return g_generators.back().get();
+    }
+
+    void releaseGenerator(OrderIdGenerator* generator) {
+        std::lock_guard<std::mutex> lock(g_shardMutex);
+        g_idle.push_back(generator);
+    }
+
+    // A thread's claim on one shard, given back when the thread exits
+    struct ThreadShard {
+        OrderIdGenerator* generator = acquireGenerator();
+        ~ThreadShard() { releaseGenerator(generator); }
+    };
+}
+
+OrderIdGenerator::OrderIdGenerator(uint8_t shard)
+    : refreshTicks_(EngineClock::ticksPerSecond() / 16384), shard_(shard) {}
+
+uint64_t OrderIdGenerator::nowMs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+uint64_t OrderIdGenerator::next() {
+    if constexpr (EngineClock::simulated) return next(EngineClock::now() / 1'000'000);
+
+    uint64_t tick = EngineClock::now();
+    if (tick - cachedTick_ >= refreshTicks_) {
+        cachedTick_ = tick;
+        cachedMs_ = nowMs();
+    }
+    return next(cachedMs_);
+}
+
+uint64_t OrderIdGenerator::next(uint64_t unixMs) {
+    uint64_t ms = unixMs > ID_EPOCH_MS ? unixMs - ID_EPOCH_MS : 0;
+    if (ms > lastMs_) {
+        lastMs_ = ms;
+        sequence_ = 0;
+    } else if (++sequence_ == (1u << SEQUENCE_BITS)) {
+        // Clock went back or the millisecond is used up: stay monotonic
+        ++lastMs_;
+        sequence_ = 0;
+    }
+    return ((lastMs_ & ((uint64_t(1) << TIME_BITS) - 1)) << (SHARD_BITS + SEQUENCE_BITS))
+        | (uint64_t(shard_) << SEQUENCE_BITS)
+        | sequence_;
+}
+
+uint8_t OrderIdGenerator::shard() const {
+    return shard_;
+}
+
+OrderIdGenerator& OrderIdGenerator::local() {
+    thread_local ThreadShard shard;
+    return *shard.generator;
+}
+
+uint64_t OrderIdGenerator::timestampMs(uint64_t id) {
+    return (id >> (SHARD_BITS + SEQUENCE_BITS)) + ID_EPOCH_MS;
+}
+
+uint8_t OrderIdGenerator::shardOf(uint64_t id) {
+    return static_cast<uint8_t>(id >> SEQUENCE_BITS);
+}
+
+uint32_t OrderIdGenerator::sequenceOf(uint64_t id) {
+    return static_cast<uint32_t>(id & ((1u << SEQUENCE_BITS) - 1));
+}
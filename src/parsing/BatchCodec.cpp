@@ -0,0 +1,156 @@
+#include <BatchCodec.h>
+#include <BatchFrame.h>
+#include <WireOrder.h>
+#include <Crc32c.h>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <winsock2.h>
+#else
+#include <arpa/inet.h>
+#endif
+
+namespace {
+
+void storeCrc(uint8_t* dst, uint32_t crc) {
+    crc = htonl(crc);
+    std::memcpy(dst, &crc, sizeof(crc));
+}
+
+uint32_t loadCrc(const uint8_t* src) {
+    uint32_t crc;
+    std::memcpy(&crc, src, sizeof(crc));
+    return ntohl(crc);
+}
+
+} // namespace
+
+BatchEncoder::BatchEncoder(const batch::LinkConfig& link)
+    : link_(link), stride_(batch::stride(link)), count_(0) {
+    size_t overhead = sizeof(BatchHeader) + (link.crc == batch::CrcMode::PerBatch ? batch::CRC_BYTES : 0);
+    if (link.maxFrameBytes < overhead + stride_)
+        throw std::invalid_argument("Frame must hold a header and at least one message");
+    capacity_ = (link.maxFrameBytes - overhead) / stride_;
+    if (capacity_ > UINT16_MAX) capacity_ = UINT16_MAX;
+    // Sized once up front; zero-filled so padding bytes never leak stale data
+    buffer_.assign(overhead + capacity_ * stride_, 0);
+}
+
+bool BatchEncoder::add(const Order& order) {
+    if (count_ == capacity_) return false;
+    uint8_t* msg = buffer_.data() + sizeof(BatchHeader) + count_ * stride_;
+    size_t msgSize = batch::messageSize(link_.format);
+    if (link_.format == WireFormat::Aligned)
+        parser_.serializeAlignedTo(order, msg);
+    else
+        parser_.serializeTo(order, msg);
+    if (link_.crc == batch::CrcMode::PerMessage)
+        storeCrc(msg + msgSize, Crc32c::computeShort(msg, msgSize));
+    ++count_;
+    return true;
+}
+
+const uint8_t* BatchEncoder::finish(uint64_t sequence, uint64_t sendTimestampNs, size_t& length) {
+    length = sizeof(BatchHeader) + count_ * stride_;
+    if (link_.crc == batch::CrcMode::PerBatch) length += batch::CRC_BYTES;
+
+    BatchHeader h{};
+    h.magic             = htonl(batch::MAGIC);
+    h.version           = htons(batch::VERSION);
+    h.count             = htons(static_cast<uint16_t>(count_));
+    h.total_length      = htonl(static_cast<uint32_t>(length));
+    h.stride            = htons(static_cast<uint16_t>(stride_));
+    h.flags             = link_.crc == batch::CrcMode::PerMessage ? batch::FLAG_CRC_PER_MESSAGE
+                        : link_.crc == batch::CrcMode::PerBatch   ? batch::FLAG_CRC_PER_BATCH
+                        : 0;
+    h.format            = static_cast<uint8_t>(link_.format);
+    h.sequence          = wire::hton64(sequence);
+    h.send_timestamp_ns = wire::hton64(sendTimestampNs);
+    std::memcpy(buffer_.data(), &h, sizeof(BatchHeader));
+
+    if (link_.crc == batch::CrcMode::PerBatch) {
+        size_t covered = length - batch::CRC_BYTES;
+        storeCrc(buffer_.data() + covered, Crc32c::compute(buffer_.data(), covered));
+    }
+
+    return buffer_.data();
+}
+
+void BatchEncoder::reset() {
+    count_ = 0;
+}
+
+size_t BatchEncoder::count() const {
+    return count_;
+}
+
+size_t BatchEncoder::capacity() const {
+    return capacity_;
+}
+
+bool BatchEncoder::full() const {
+    return count_ == capacity_;
+}
+
+bool BatchEncoder::empty() const {
+    return count_ == 0;
+}
+
+std::optional<size_t> BatchDecoder::decode(const uint8_t* data, size_t size, Order* out, size_t maxOut) {
+    if (size < sizeof(BatchHeader)) return std::nullopt;
+
+    BatchHeader h;
+    std::memcpy(&h, data, sizeof(BatchHeader));
+    h.magic             = ntohl(h.magic);
+    h.version           = ntohs(h.version);
+    h.count             = ntohs(h.count);
+    h.total_length      = ntohl(h.total_length);
+    h.stride            = ntohs(h.stride);
+    h.sequence          = wire::ntoh64(h.sequence);
+    h.send_timestamp_ns = wire::ntoh64(h.send_timestamp_ns);
+
+    // Frame validation
+    if (h.magic != batch::MAGIC || h.version != batch::VERSION) return std::nullopt;
+    if (h.format > static_cast<uint8_t>(WireFormat::Aligned)) return std::nullopt;
+    bool crcPerMessage = h.flags & batch::FLAG_CRC_PER_MESSAGE;
+    bool crcPerBatch = h.flags & batch::FLAG_CRC_PER_BATCH;
+    WireFormat format = static_cast<WireFormat>(h.format);
+    size_t minStride = batch::messageSize(format) + (crcPerMessage ? batch::CRC_BYTES : 0);
+    size_t bodyEnd = sizeof(BatchHeader) + size_t(h.count) * h.stride;
+
+    if (h.total_length > size || h.stride < minStride) return std::nullopt;
+    if (bodyEnd + (crcPerBatch ? batch::CRC_BYTES : 0) > h.total_length) return std::nullopt;
+    if (h.count > maxOut) return std::nullopt;
+
+    // A batch CRC covers the frame exactly as sent, so the whole frame is dropped on mismatch
+    if (crcPerBatch && Crc32c::compute(data, bodyEnd) != loadCrc(data + bodyEnd)) {
+        ++crcFailures_;
+        return std::nullopt;
+    }
+
+    if (expectedSequence_ != 0 && h.sequence != expectedSequence_) ++sequenceGaps_;
+    expectedSequence_ = h.sequence + 1;
+    last_ = h;
+
+    const uint8_t* body = data + sizeof(BatchHeader);
+    size_t failures = 0;
+    size_t* verify = crcPerMessage ? &failures : nullptr;
+    size_t accepted = format == WireFormat::Aligned
+        ? parser_.parseBatchAligned(body, h.count, h.stride, out, verify)
+        : parser_.parseBatch(body, h.count, h.stride, out, verify);
+    crcFailures_ += failures;
+    return accepted;
+}
+
+const BatchHeader& BatchDecoder::lastHeader() const {
+    return last_;
+}
+
+uint64_t BatchDecoder::sequenceGaps() const {
+    return sequenceGaps_;
+}
+
+uint64_t BatchDecoder::crcFailures() const {
+    return crcFailures_;
+}
@@ -0,0 +1,132 @@
+#include <Crc32c.h>
+#include <array>
+#include <cstring>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+namespace {
+
+constexpr uint32_t POLY = 0x82F63B78; // reflected Castagnoli polynomial
+
+// Stream lengths for the interleaved loop; the tail is finished single-stream
+constexpr size_t LONG_BLOCK = 256;
+constexpr size_t SHORT_BLOCK = 64;
+
+// Multiply a and b modulo POLY (bit-reflected, so 1 << 31 is x^0)
+constexpr uint32_t multModP(uint32_t a, uint32_t b) {
+    uint32_t m = uint32_t(1) << 31;
+    uint32_t p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0) break;
+        }
+        m >>= 1;
+        b = (b & 1) ? (b >> 1) ^ POLY : b >> 1;
+    }
+    return p;
+}
+
+// x^(8 * bytes) mod POLY: the operator that appends `bytes` zero bytes to a CRC register
+constexpr uint32_t zeroBytesOperator(size_t bytes) {
+    uint32_t p = uint32_t(1) << 31;
+    for (size_t i = 0; i < 8 * bytes; ++i)
+        p = (p & 1) ? (p >> 1) ^ POLY : p >> 1;
+    return p;
+}
+
+using ShiftTable = std::array<std::array<uint32_t, 256>, 4>;
+
+// Byte-sliced form of multModP(op, crc) so shifting a register costs four lookups
+constexpr ShiftTable makeShiftTable(size_t bytes) {
+    ShiftTable t{};
+    uint32_t op = zeroBytesOperator(bytes);
+    for (size_t k = 0; k < 4; ++k)
+        for (uint32_t v = 0; v < 256; ++v)
+            t[k][v] = multModP(op, v << (8 * k));
+    return t;
+}
+
+constexpr std::array<uint32_t, 256> makeByteTable() {
+    std::array<uint32_t, 256> t{};
+    for (uint32_t v = 0; v < 256; ++v) {
+        uint32_t c = v;
+        for (int i = 0; i < 8; ++i)
+            c = (c & 1) ? (c >> 1) ^ POLY : c >> 1;
+        t[v] = c;
+    }
+    return t;
+}
+
+[[maybe_unused]] constexpr ShiftTable LONG_SHIFT = makeShiftTable(LONG_BLOCK);
+[[maybe_unused]] constexpr ShiftTable SHORT_SHIFT = makeShiftTable(SHORT_BLOCK);
+[[maybe_unused]] constexpr std::array<uint32_t, 256> BYTE_TABLE = makeByteTable();
+
+[[maybe_unused]] inline uint32_t shift(const ShiftTable& t, uint32_t crc) {
+    return t[0][crc & 0xFF] ^ t[1][(crc >> 8) & 0xFF] ^ t[2][(crc >> 16) & 0xFF] ^ t[3][crc >> 24];
+}
+
+#if defined(__SSE4_2__)
+
+inline uint64_t load64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// Raw (non-inverted) register update over a single stream
+inline uint32_t crcSingle(uint32_t crc, const uint8_t* p, size_t size) {
+    uint64_t c = crc;
+    for (; size >= 8; size -= 8, p += 8)
+        c = _mm_crc32_u64(c, load64(p));
+    crc = static_cast<uint32_t>(c);
+    for (; size > 0; --size, ++p)
+        crc = _mm_crc32_u8(crc, *p);
+    return crc;
+}
+
+// Three independent streams hide the instruction's 3-cycle latency; the
+// partial registers are then merged by shifting each over the blocks after it
+template <size_t BLOCK>
+inline uint32_t crcTriple(uint32_t crc, const uint8_t*& p, size_t& size, const ShiftTable& t) {
+    while (size >= 3 * BLOCK) {
+        uint64_t c0 = crc, c1 = 0, c2 = 0;
+        for (size_t i = 0; i < BLOCK; i += 8) {
+            c0 = _mm_crc32_u64(c0, load64(p + i));
+            c1 = _mm_crc32_u64(c1, load64(p + BLOCK + i));
+            c2 = _mm_crc32_u64(c2, load64(p + 2 * BLOCK + i));
+        }
+        crc = shift(t, static_cast<uint32_t>(c0)) ^ static_cast<uint32_t>(c1);
+        crc = shift(t, crc) ^ static_cast<uint32_t>(c2);
+        p += 3 * BLOCK;
+        size -= 3 * BLOCK;
+    }
+    return crc;
+}
+
+#else
+
+inline uint32_t crcSingle(uint32_t crc, const uint8_t* p, size_t size) {
+    for (; size > 0; --size, ++p)
+        crc = BYTE_TABLE[(crc ^ *p) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+#endif
+
+} // namespace
+
+uint32_t Crc32c::compute(const uint8_t* data, size_t size, uint32_t crc) {
+    crc = ~crc;
+#if defined(__SSE4_2__)
+    crc = crcTriple<LONG_BLOCK>(crc, data, size, LONG_SHIFT);
+    crc = crcTriple<SHORT_BLOCK>(crc, data, size, SHORT_SHIFT);
+#endif
+    return ~crcSingle(crc, data, size);
+}
+
+uint32_t Crc32c::computeShort(const uint8_t* data, size_t size, uint32_t crc) {
+    return ~crcSingle(~crc, data, size);
+}
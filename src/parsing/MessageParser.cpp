@@ -1,13 +1,16 @@
 #include <MessageParser.h>
 #include <WireOrder.h>
+#include <Crc32c.h>
+#include <Clock.h>
 #include <optional>
+#include <algorithm>
 #include <vector>
 #include <bit>
+#include <memory>
 #include <cstdint>
 #include <cctype>
 #include <cstring>
 #include <inttypes.h>
-#include <x86intrin.h>
 #include <iostream>
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -26,8 +29,22 @@ return false;
 #endif
 }
 
-uint64_t timestamps_RDTSC[MessageParser::MAX_SAMPLES];
-static uint64_t s_idx;
+// Per-thread sample window, so parsers on different threads never share it.
+// Allocated on first use (8 MB is too large for static TLS).
+static thread_local std::unique_ptr<uint64_t[]> t_samples;
+static thread_local uint64_t s_idx;
+
+static uint64_t (&timestamps_RDTSC())[MessageParser::MAX_SAMPLES] {
+    if (!t_samples) t_samples = std::make_unique<uint64_t[]>(MessageParser::MAX_SAMPLES);
+    return *reinterpret_cast<uint64_t (*)[MessageParser::MAX_SAMPLES]>(t_samples.get());
+}
+
+static thread_local uint64_t t_outlierTicks = UINT64_MAX;
+static thread_local std::vector<LatencyOutlier> t_outliers;
+
+static void noteOutlier(uint64_t start, uint64_t ticks) {
+    if (t_outliers.size() < MessageParser::MAX_OUTLIERS) t_outliers.push_back(LatencyOutlier{start, ticks});
+}
 
 //Record latency in circular buffer
 void MessageParser::recordLatency(uint64_t (&timestampArr)[MessageParser::MAX_SAMPLES], uint64_t latency) {
@@ -35,12 +52,31 @@ void MessageParser::recordLatency(uint64_t (&timestampArr)[MessageParser::MAX_SA
     ++s_idx;
 }
 
+void MessageParser::setSecurityMaster(const SecurityMaster* master) {
+    securityMaster_ = master;
+}
+
 uint64_t MessageParser::getIndex() {
     return s_idx;
 }
 
+void MessageParser::resetLatency() {
+    timestamps_RDTSC();
+    s_idx = 0;
+    t_outliers.clear();
+}
+
+void MessageParser::setOutlierThreshold(uint64_t ns) {
+    t_outlierTicks = ns ? std::max<uint64_t>(nanosToTicks(ns), 1) : UINT64_MAX;
+    if (ns) t_outliers.reserve(MAX_OUTLIERS);
+}
+
+const std::vector<LatencyOutlier>& MessageParser::getOutliers() {
+    return t_outliers;
+}
+
 uint64_t (&MessageParser::getTimestampList())[MessageParser::MAX_SAMPLES] {
-    return timestamps_RDTSC;
+    return timestamps_RDTSC();
 }
 
 size_t MessageParser::getMaxSamples() {
@@ -48,73 +84,173 @@ size_t MessageParser::getMaxSamples() {
 }
 
 std::optional<Order> MessageParser::parse(const uint8_t* data, size_t size) {
+    return parseImpl<WireOrder>(data, size);
+}
+
+std::optional<Order> MessageParser::parseAligned(const uint8_t* data, size_t size) {
+    return parseImpl<AlignedWireOrder>(data, size);
+}
+
+template <typename Wire>
+std::optional<Order> MessageParser::parseImpl(const uint8_t* data, size_t size) {
     checkHTONLL();
 
-    uint64_t start = __rdtsc();
+    uint64_t start = EngineClock::now();
 
-    if (size < sizeof(WireOrder)) return std::nullopt;
+    if (size < sizeof(Wire)) return std::nullopt;
 
-    WireOrder w{};
-    std::memcpy(&w, data, sizeof(WireOrder)); 
+    Wire w{};
+    std::memcpy(&w, data, sizeof(Wire)); 
 
     Order o{};
-    o.order_id     = ntoh64(w.order_id);
-    o.timestamp_ns = ntoh64(w.timestamp_ns);
-    o.price        = uint64ToDouble(ntoh64(w.price));
+    o.order_id     = wire::ntoh64(w.order_id);
+    o.timestamp_ns = wire::ntoh64(w.timestamp_ns);
+    o.price        = wire::uint64ToDouble(wire::ntoh64(w.price));
     o.quantity     = ntohl(w.quantity);
     std::memcpy(o.symbol, w.symbol, sizeof(w.symbol));
     o.side = static_cast<Side>(w.side);
     o.type = static_cast<OrderType>(w.type);
 
-    if (!validateSymbol(o.symbol) || !validatePrice(o.price) || !validateQuantity(o.quantity))
+    if (securityMaster_) {
+        o.instrument_id = securityMaster_->lookup(o.symbol);
+        if (o.instrument_id == SecurityMaster::NOT_FOUND) return std::nullopt;
+    }
+    else if (!validateSymbol(o.symbol)) return std::nullopt;
+
+    if (!validatePrice(o.price) || !validateQuantity(o.quantity))
         return std::nullopt;
 
-    uint64_t end = __rdtsc();
-    recordLatency(timestamps_RDTSC, end - start);
+    uint64_t end = EngineClock::now();
+    recordLatency(timestamps_RDTSC(), end - start);
+    if (end - start > t_outlierTicks) [[unlikely]] noteOutlier(start, end - start);
 
     return o;
 }
 
 std::vector<uint8_t> MessageParser::serialize(const Order& order) {
+    std::vector<uint8_t> buffer(sizeof(WireOrder));
+    serializeTo(order, buffer.data());
+    return buffer;
+}
+
+void MessageParser::serializeTo(const Order& order, uint8_t* out) {
+    serializeImpl<WireOrder>(order, out);
+}
+
+void MessageParser::serializeAlignedTo(const Order& order, uint8_t* out) {
+    serializeImpl<AlignedWireOrder>(order, out);
+}
+
+template <typename Wire>
+void MessageParser::serializeImpl(const Order& order, uint8_t* out) {
     checkHTONLL();
 
-    // 1. Create a WireOrder and fill fields
-    WireOrder w{};
-    w.order_id     = hton64(order.order_id);
-    w.timestamp_ns = hton64(order.timestamp_ns);
-    w.price        = hton64(doubleToUint64(order.price));
+    // 1. Create a wire struct and fill fields
+    Wire w{};
+    w.order_id     = wire::hton64(order.order_id);
+    w.timestamp_ns = wire::hton64(order.timestamp_ns);
+    w.price        = wire::hton64(wire::doubleToUint64(order.price));
     w.quantity     = htonl(order.quantity);
     std::memcpy(w.symbol, order.symbol, sizeof(w.symbol));
     w.side = static_cast<Side>(order.side);  
     w.type = static_cast<OrderType>(order.type); 
 
-    // 2. Copy WireOrder bytes into a vector
-    std::vector<uint8_t> buffer(sizeof(WireOrder));
-    std::memcpy(buffer.data(), &w, sizeof(WireOrder));
+    // 2. Copy wire bytes into the caller's buffer
+    std::memcpy(out, &w, sizeof(Wire));
+}
 
-    return buffer;
+size_t MessageParser::parseBatch(const uint8_t* data, size_t count, size_t stride, Order* out, size_t* crcFailures) {
+    return parseBatchImpl<WireOrder, 1>(data, count, stride, out, crcFailures);
+}
+
+size_t MessageParser::parseBatchAligned(const uint8_t* data, size_t count, size_t stride, Order* out, size_t* crcFailures) {
+    // Fast path only when every message really is 8-byte aligned
+    constexpr size_t align = alignof(AlignedWireOrder);
+    if (reinterpret_cast<uintptr_t>(data) % align == 0 && stride % align == 0)
+        return parseBatchImpl<AlignedWireOrder, align>(data, count, stride, out, crcFailures);
+    return parseBatchImpl<AlignedWireOrder, 1>(data, count, stride, out, crcFailures);
+}
+
+template <typename Wire, size_t Alignment>
+size_t MessageParser::parseBatchImpl(const uint8_t* data, size_t count, size_t stride, Order* out, size_t* crcFailures) {
+    const bool verifyCrc = crcFailures != nullptr;
+    if (count == 0 || stride < sizeof(Wire) + (verifyCrc ? sizeof(uint32_t) : 0)) return 0;
+
+    uint64_t start = EngineClock::now();
+
+    // Straight-line decode of every message; rejected orders are overwritten
+    // by the next one instead of branching out of the loop
+    size_t accepted = 0;
+    size_t corrupted = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* msg = std::assume_aligned<Alignment>(data + i * stride);
+        Wire w;
+        std::memcpy(&w, msg, sizeof(Wire));
+
+        // Checked while the message is still in L1 from the load above
+        bool intact = true;
+        if (verifyCrc) {
+            uint32_t expected;
+            std::memcpy(&expected, msg + sizeof(Wire), sizeof(expected));
+            intact = Crc32c::computeShort(msg, sizeof(Wire)) == ntohl(expected);
+            corrupted += !intact;
+        }
+
+        Order& o = out[accepted];
+        o.order_id     = wire::ntoh64(w.order_id);
+        o.timestamp_ns = wire::ntoh64(w.timestamp_ns);
+        o.price        = wire::uint64ToDouble(wire::ntoh64(w.price));
+        o.quantity     = ntohl(w.quantity);
+        std::memcpy(o.symbol, w.symbol, sizeof(w.symbol));
+        o.side = static_cast<Side>(w.side);
+        o.type = static_cast<OrderType>(w.type);
+
+        bool knownSymbol;
+        if (securityMaster_) {
+            o.instrument_id = securityMaster_->lookup(o.symbol);
+            knownSymbol = o.instrument_id != SecurityMaster::NOT_FOUND;
+        } else {
+            o.instrument_id = Order::NO_INSTRUMENT;
+            knownSymbol = validateSymbolBranchless(o.symbol);
+        }
+
+        bool valid = intact & knownSymbol & validatePrice(o.price) & validateQuantity(o.quantity);
+        accepted += valid;
+    }
+    if (verifyCrc) *crcFailures = corrupted;
+
+    // One sample per batch, amortised over its messages
+    uint64_t end = EngineClock::now();
+    recordLatency(timestamps_RDTSC(), (end - start) / count);
+    if (end - start > t_outlierTicks) [[unlikely]] noteOutlier(start, end - start);
+
+    return accepted;
 }
 
 // Byte-order helpers
-uint64_t MessageParser::hton64(uint64_t value) {
+namespace wire {
+
+uint64_t hton64(uint64_t value) {
     return htonll(value);
 }
-uint64_t MessageParser::ntoh64(uint64_t value) {
+uint64_t ntoh64(uint64_t value) {
     return ntohll(value);
 }
 
-uint64_t MessageParser::doubleToUint64(double value) {
+uint64_t doubleToUint64(double value) {
     uint64_t result;
     std::memcpy(&result, &value, sizeof(uint64_t));
     return result;
 }
 
-double MessageParser::uint64ToDouble(uint64_t value) {
+double uint64ToDouble(uint64_t value) {
     double result; 
     std::memcpy(&result, &value, sizeof(double)); 
     return result;
 }
 
+} // namespace wire
+
 // Validation helpers
 bool MessageParser::validateSymbol(const char* symbol) {
     for (size_t i = 0; i < 8; ++i) { 
@@ -126,6 +262,20 @@ bool MessageParser::validateSymbol(const char* symbol) {
     return true;
 }
 
+// Same rule as validateSymbol (alphanumeric up to the first NUL), evaluated
+// over all 8 bytes without early exits so the batch loop stays branch-free
+bool MessageParser::validateSymbolBranchless(const char* symbol) {
+    bool ok = true;
+    bool terminated = false;
+    for (size_t i = 0; i < 8; ++i) {
+        unsigned char c = static_cast<unsigned char>(symbol[i]);
+        terminated |= (c == '\0');
+        bool alnum = (unsigned(c - '0') < 10u) | (unsigned((c | 0x20) - 'a') < 26u);
+        ok &= terminated | alnum;
+    }
+    return ok;
+}
+
 bool MessageParser::validatePrice(double price) {
     return price > 0.0;
 }
@@ -135,5 +285,5 @@ bool MessageParser::validateQuantity(uint32_t qty) {
 
 // Timestamp
 uint64_t MessageParser::captureTimestamp() {
-    return __rdtsc();
+    return EngineClock::now();
 }
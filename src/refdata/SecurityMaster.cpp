@@ -0,0 +1,177 @@
+#include <SecurityMaster.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+uint64_t symbolKey(const char* symbol) {
+    uint64_t key = 0;
+    std::memcpy(&key, symbol, sizeof(key));
+    return key;
+}
+
+uint64_t hashKey(uint64_t key, uint32_t seed) {
+    key ^= (uint64_t(seed) + 1) * 0x9E3779B97F4A7C15ULL;
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+// Maps a hash onto [0, n) without a division
+uint32_t reduce(uint64_t hash, uint32_t n) {
+    return static_cast<uint32_t>(((hash >> 32) * n) >> 32);
+}
+
+size_t align8(size_t offset) {
+    return (offset + 7) & ~size_t(7);
+}
+
+constexpr uint32_t MAX_DISPLACEMENT = 1u << 20;
+
+// Tick and lot the risk stage can divide by, and a non-empty price band
+bool validInstrument(const InstrumentRef& ref) {
+    return ref.tickSize > 0.0 && ref.lotSize > 0 && ref.minPrice <= ref.maxPrice;
+}
+
+} // namespace
+
+SecurityMaster::SecurityMaster(const std::string& path) : file_(path, true) {
+    if (file_.size() < sizeof(SecurityMasterHeader))
+        throw std::runtime_error("Security master too small: " + path);
+    header_ = reinterpret_cast<const SecurityMasterHeader*>(file_.data());
+    if (header_->magic != MAGIC || header_->version != VERSION)
+        throw std::runtime_error("Not a security master file: " + path);
+
+    const SecurityMasterHeader& h = *header_;
+    const size_t size = file_.size();
+    if (h.bucketCount == 0 || h.slotCount < h.count ||
+        h.instrumentsOffset > size || size_t(h.count) * sizeof(InstrumentRef) > size - h.instrumentsOffset ||
+        h.displacementsOffset > size || size_t(h.bucketCount) * sizeof(uint32_t) > size - h.displacementsOffset ||
+        h.slotsOffset > size || size_t(h.slotCount) * sizeof(uint32_t) > size - h.slotsOffset)
+        throw std::runtime_error("Corrupt security master: " + path);
+
+    instruments_ = reinterpret_cast<const InstrumentRef*>(file_.data() + h.instrumentsOffset);
+    displacements_ = reinterpret_cast<const uint32_t*>(file_.data() + h.displacementsOffset);
+    slots_ = reinterpret_cast<const uint32_t*>(file_.data() + h.slotsOffset);
+
+    // lookup() indexes instruments_ with any slot that is not NOT_FOUND
+    for (uint32_t s = 0; s < h.slotCount; ++s)
+        if (slots_[s] != NOT_FOUND && slots_[s] >= h.count)
+            throw std::runtime_error("Corrupt security master (slot " + std::to_string(s) + "): " + path);
+    for (uint32_t id = 0; id < h.count; ++id)
+        if (!validInstrument(instruments_[id]))
+            throw std::runtime_error("Corrupt security master (instrument " + std::to_string(id) + "): " + path);
+}
+
+uint32_t SecurityMaster::lookup(const char* symbol) const {
+    uint64_t key = symbolKey(symbol);
+    uint32_t bucket = reduce(hashKey(key, 0), header_->bucketCount);
+    uint32_t id = slots_[reduce(hashKey(key, displacements_[bucket]), header_->slotCount)];
+    // A perfect hash maps non-members somewhere too, so confirm the symbol
+    if (id == NOT_FOUND || symbolKey(instruments_[id].symbol) != key) return NOT_FOUND;
+    return id;
+}
+
+const InstrumentRef& SecurityMaster::instrument(uint32_t id) const {
+    return instruments_[id];
+}
+
+size_t SecurityMaster::size() const {
+    return header_->count;
+}
+
+bool SecurityMaster::writeFile(const std::string& path, const std::vector<InstrumentRef>& instruments) {
+    const uint32_t count = static_cast<uint32_t>(instruments.size());
+    const uint32_t bucketCount = std::max<uint32_t>(1, count / 4);
+    const uint32_t slotCount = std::max<uint32_t>(1, count + count / 4);
+
+    std::vector<uint64_t> keys(count);
+    for (uint32_t i = 0; i < count; ++i)
+        keys[i] = symbolKey(instruments[i].symbol);
+
+    std::vector<std::vector<uint32_t>> buckets(bucketCount);
+    for (uint32_t i = 0; i < count; ++i)
+        buckets[reduce(hashKey(keys[i], 0), bucketCount)].push_back(i);
+
+    // Place the most crowded buckets first while the table is still empty
+    std::vector<uint32_t> order(bucketCount);
+    for (uint32_t b = 0; b < bucketCount; ++b) order[b] = b;
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    std::vector<uint32_t> displacements(bucketCount, 0);
+    std::vector<uint32_t> slots(slotCount, NOT_FOUND);
+    std::vector<uint32_t> placed;
+    for (uint32_t b : order) {
+        if (buckets[b].empty()) break;
+        bool ok = false;
+        for (uint32_t d = 1; d < MAX_DISPLACEMENT && !ok; ++d) {
+            placed.clear();
+            ok = true;
+            for (uint32_t i : buckets[b]) {
+                uint32_t s = reduce(hashKey(keys[i], d), slotCount);
+                if (slots[s] != NOT_FOUND || std::find(placed.begin(), placed.end(), s) != placed.end()) {
+                    ok = false;
+                    break;
+                }
+                placed.push_back(s);
+            }
+            if (ok) {
+                displacements[b] = d;
+                for (size_t k = 0; k < placed.size(); ++k)
+                    slots[placed[k]] = buckets[b][k];
+            }
+        }
+        if (!ok) return false; // duplicate symbols never separate
+    }
+
+    SecurityMasterHeader h{};
+    h.magic = MAGIC;
+    h.version = VERSION;
+    h.count = count;
+    h.bucketCount = bucketCount;
+    h.slotCount = slotCount;
+    h.instrumentsOffset = align8(sizeof(SecurityMasterHeader));
+    h.displacementsOffset = align8(h.instrumentsOffset + size_t(count) * sizeof(InstrumentRef));
+    h.slotsOffset = align8(h.displacementsOffset + size_t(bucketCount) * sizeof(uint32_t));
+
+    std::vector<uint8_t> out(h.slotsOffset + size_t(slotCount) * sizeof(uint32_t), 0);
+    std::memcpy(out.data(), &h, sizeof(h));
+    std::memcpy(out.data() + h.instrumentsOffset, instruments.data(), size_t(count) * sizeof(InstrumentRef));
+    std::memcpy(out.data() + h.displacementsOffset, displacements.data(), size_t(bucketCount) * sizeof(uint32_t));
+    std::memcpy(out.data() + h.slotsOffset, slots.data(), size_t(slotCount) * sizeof(uint32_t));
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+    return static_cast<bool>(file);
+}
+
+std::optional<std::vector<InstrumentRef>> SecurityMaster::readCsv(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) return std::nullopt;
+
+    std::vector<InstrumentRef> instruments;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::istringstream fields(line);
+        std::string symbol;
+        InstrumentRef ref{};
+        if (!(fields >> symbol >> ref.tickSize >> ref.lotSize >> ref.minPrice >> ref.maxPrice)) {
+            if (instruments.empty()) continue; // header line
+            return std::nullopt;
+        }
+        if (symbol.size() > sizeof(ref.symbol) || !validInstrument(ref)) return std::nullopt;
+        std::memcpy(ref.symbol, symbol.data(), symbol.size());
+        instruments.push_back(ref);
+    }
+    return instruments;
+}
@@ -0,0 +1,100 @@
+#include <DuplicateFilter.h>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+// Second mix (murmur3 fmix64) for the probe bits, so they do not reuse the
+// hash bits that already chose the block
+inline uint64_t probeHash(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ull;
+    return hash ^ (hash >> 33);
+}
+
+// Bit to set in each of the block's 8 words, 6 bits of the probe hash per word
+inline uint64_t probeBit(uint64_t probes, size_t word) {
+    return uint64_t(1) << ((probes >> (6 * word)) & 63);
+}
+
+} // namespace
+
+BlockedBloomFilter::BlockedBloomFilter(size_t expectedKeys, double bitsPerKey) {
+    if (expectedKeys == 0 || bitsPerKey <= 0.0)
+        throw std::invalid_argument("Bloom filter needs expectedKeys > 0 and bitsPerKey > 0");
+    size_t blocks = static_cast<size_t>(expectedKeys * bitsPerKey / 512.0) + 1;
+    blocks_.resize(blocks);
+    clear();
+}
+
+// Top 32 bits pick the block (multiply-shift, no modulo); probeHash picks the bits
+size_t BlockedBloomFilter::blockIndex(uint64_t hash) const {
+    return static_cast<size_t>(((hash >> 32) * blocks_.size()) >> 32);
+}
+
+bool BlockedBloomFilter::testAndAdd(uint64_t hash) {
+    Block& b = blocks_[blockIndex(hash)];
+    const uint64_t probes = probeHash(hash);
+    bool present = true;
+    for (size_t w = 0; w < 8; ++w) {
+        uint64_t bit = probeBit(probes, w);
+        present &= (b.words[w] & bit) != 0;
+        b.words[w] |= bit;
+    }
+    return present;
+}
+
+bool BlockedBloomFilter::mayContain(uint64_t hash) const {
+    const Block& b = blocks_[blockIndex(hash)];
+    const uint64_t probes = probeHash(hash);
+    bool present = true;
+    for (size_t w = 0; w < 8; ++w)
+        present &= (b.words[w] & probeBit(probes, w)) != 0;
+    return present;
+}
+
+void BlockedBloomFilter::clear() {
+    std::memset(blocks_.data(), 0, blocks_.size() * sizeof(Block));
+}
+
+size_t BlockedBloomFilter::sizeBytes() const {
+    return blocks_.size() * sizeof(Block);
+}
+
+DuplicateDetector::DuplicateDetector(size_t expectedIds, size_t maxLiveOrders, double bitsPerId)
+    : bloom_(expectedIds, bitsPerId), live_(maxLiveOrders) {}
+
+bool DuplicateDetector::isDuplicate(uint64_t orderId) {
+    // Common case: bloom miss, one cache line touched
+    if (!bloom_.testAndAdd(LiveOrderIndex::hash(orderId))) {
+        untracked_ += !live_.insert(orderId);
+        return false;
+    }
+
+    ++bloomPositives_;
+    if (live_.contains(orderId)) {
+        ++duplicates_;
+        return true;
+    }
+    // False positive, or an id whose order has already closed
+    untracked_ += !live_.insert(orderId);
+    return false;
+}
+
+void DuplicateDetector::onOrderClosed(uint64_t orderId) {
+    live_.erase(orderId);
+}
+
+uint64_t DuplicateDetector::duplicates() const {
+    return duplicates_;
+}
+
+uint64_t DuplicateDetector::bloomPositives() const {
+    return bloomPositives_;
+}
+
+uint64_t DuplicateDetector::untracked() const {
+    return untracked_;
+}
@@ -0,0 +1,84 @@
+#include <LiveOrderIndex.h>
+#include <bit>
+#include <stdexcept>
+
+LiveOrderIndex::LiveOrderIndex(size_t maxLiveOrders) : maxSize_(maxLiveOrders) {
+    if (maxLiveOrders == 0)
+        throw std::invalid_argument("LiveOrderIndex capacity must be > 0");
+    // Keep the load factor at or below 50% so probe runs stay short
+    size_t slots = std::bit_ceil(maxLiveOrders * 2);
+    slots_.assign(slots, EMPTY);
+    mask_ = slots - 1;
+}
+
+// splitmix64 finaliser
+uint64_t LiveOrderIndex::hash(uint64_t key) {
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+    return key;
+}
+
+bool LiveOrderIndex::insert(uint64_t orderId) {
+    if (size_ == maxSize_) return false;
+    if (orderId == EMPTY) {
+        if (hasEmptyKey_) return false;
+        hasEmptyKey_ = true;
+        ++size_;
+        return true;
+    }
+    for (size_t i = hash(orderId) & mask_;; i = (i + 1) & mask_) {
+        if (slots_[i] == orderId) return false;
+        if (slots_[i] == EMPTY) {
+            slots_[i] = orderId;
+            ++size_;
+            return true;
+        }
+    }
+}
+
+bool LiveOrderIndex::erase(uint64_t orderId) {
+    if (orderId == EMPTY) {
+        if (!hasEmptyKey_) return false;
+        hasEmptyKey_ = false;
+        --size_;
+        return true;
+    }
+    size_t i = hash(orderId) & mask_;
+    while (slots_[i] != orderId) {
+        if (slots_[i] == EMPTY) return false;
+        i = (i + 1) & mask_;
+    }
+
+    // Backward-shift: pull later entries of the run into the hole when their
+    // home slot does not lie between the hole and their current position
+    size_t hole = i;
+    for (size_t j = (i + 1) & mask_; slots_[j] != EMPTY; j = (j + 1) & mask_) {
+        size_t home = hash(slots_[j]) & mask_;
+        if (((j - home) & mask_) >= ((j - hole) & mask_)) {
+            slots_[hole] = slots_[j];
+            hole = j;
+        }
+    }
+    slots_[hole] = EMPTY;
+    --size_;
+    return true;
+}
+
+bool LiveOrderIndex::contains(uint64_t orderId) const {
+    if (orderId == EMPTY) return hasEmptyKey_;
+    for (size_t i = hash(orderId) & mask_;; i = (i + 1) & mask_) {
+        if (slots_[i] == orderId) return true;
+        if (slots_[i] == EMPTY) return false;
+    }
+}
+
+size_t LiveOrderIndex::size() const {
+    return size_;
+}
+
+size_t LiveOrderIndex::capacity() const {
+    return maxSize_;
+}
@@ -0,0 +1,129 @@
+#include <RiskCheck.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace {
+
+constexpr uint32_t bit(RiskReject reason) {
+    return uint32_t(1) << static_cast<uint32_t>(reason);
+}
+
+// Position delta of an order; the side byte comes off the wire unchecked,
+// so anything but Buy counts as a sell here and check() rejects it as BadSide
+inline int64_t signedQuantity(const Order& order) {
+    const int64_t quantity = static_cast<int64_t>(order.quantity);
+    return order.side == Side::Buy ? quantity : -quantity;
+}
+
+} // namespace
+
+const char* riskRejectName(RiskReject reason) {
+    switch (reason) {
+        case RiskReject::UnknownInstrument: return "unknown-instrument";
+        case RiskReject::UnknownAccount: return "unknown-account";
+        case RiskReject::OrderQuantity: return "order-quantity";
+        case RiskReject::PriceBand: return "price-band";
+        case RiskReject::OrderNotional: return "order-notional";
+        case RiskReject::PositionLimit: return "position-limit";
+        case RiskReject::CreditLimit: return "credit-limit";
+        case RiskReject::BadSide: return "bad-side";
+        case RiskReject::TickSize: return "tick-size";
+        case RiskReject::LotSize: return "lot-size";
+        case RiskReject::Count: break;
+    }
+    return "unknown";
+}
+
+RiskChecker::RiskChecker(const RiskLimits& limits) : limits_(&limits) {
+    // Unknown ids are redirected to slot 0 so lookups never need a branch
+    if (limits.instruments.empty() || limits.accounts.empty())
+        throw std::invalid_argument("Risk limits need at least one instrument and one account");
+    positions_.assign(limits.instruments.size(), 0);
+    grossNotional_.assign(limits.accounts.size(), 0.0);
+}
+
+void RiskChecker::setLimits(const RiskLimits& limits) {
+    if (&limits == limits_) return;
+    if (limits.instruments.empty() || limits.accounts.empty())
+        throw std::invalid_argument("Risk limits need at least one instrument and one account");
+    limits_ = &limits;
+    // Tables only grow intraday; existing ids keep their exposure
+    if (positions_.size() < limits.instruments.size())
+        positions_.resize(limits.instruments.size(), 0);
+    if (grossNotional_.size() < limits.accounts.size())
+        grossNotional_.resize(limits.accounts.size(), 0.0);
+}
+
+RiskResult RiskChecker::check(const Order& order, uint32_t instrumentId, uint32_t accountId) {
+    const bool instrumentKnown = instrumentId < limits_->instruments.size();
+    const bool accountKnown = accountId < limits_->accounts.size();
+    const uint32_t i = instrumentKnown ? instrumentId : 0;
+    const uint32_t a = accountKnown ? accountId : 0;
+
+    const InstrumentLimits& il = limits_->instruments[i];
+    const AccountLimits& al = limits_->accounts[a];
+
+    const double notional = order.price * order.quantity;
+    const bool sideKnown = (order.side == Side::Buy) | (order.side == Side::Sell);
+    const int64_t projectedPosition = positions_[i] + signedQuantity(order);
+    // Off the tick grid by more than rounding error in the division
+    const double ticks = order.price / il.tickSize;
+    const bool offTick = (il.tickSize > 0.0) & (std::abs(ticks - std::nearbyint(ticks)) > 1e-6);
+    const bool offLot = order.quantity % std::max<uint32_t>(il.lotSize, 1) != 0;
+    const double projectedGross = grossNotional_[a] + notional;
+
+    const uint32_t mask =
+        (uint32_t(!instrumentKnown) * bit(RiskReject::UnknownInstrument)) |
+        (uint32_t(!accountKnown) * bit(RiskReject::UnknownAccount)) |
+        (uint32_t((order.quantity > il.maxOrderQty) | (order.quantity > al.maxOrderQty)) * bit(RiskReject::OrderQuantity)) |
+        (uint32_t((order.price < il.minPrice) | (order.price > il.maxPrice)) * bit(RiskReject::PriceBand)) |
+        (uint32_t((notional > il.maxOrderNotional) | (notional > al.maxOrderNotional)) * bit(RiskReject::OrderNotional)) |
+        (uint32_t(std::llabs(projectedPosition) > il.maxPosition) * bit(RiskReject::PositionLimit)) |
+        (uint32_t(projectedGross > al.maxGrossNotional) * bit(RiskReject::CreditLimit)) |
+        (uint32_t(!sideKnown) * bit(RiskReject::BadSide)) |
+        (uint32_t(offTick) * bit(RiskReject::TickSize)) |
+        (uint32_t(offLot) * bit(RiskReject::LotSize));
+
+    const bool accepted = mask == 0;
+
+    // Exposure is committed with selects rather than a branch
+    positions_[i] = accepted ? projectedPosition : positions_[i];
+    grossNotional_[a] = accepted ? projectedGross : grossNotional_[a];
+
+    ++checked_;
+    rejected_ += !accepted;
+    for (uint32_t pending = mask; pending != 0; pending &= pending - 1)
+        rejectCounts_[std::countr_zero(pending)]++;
+
+    return RiskResult{accepted, mask};
+}
+
+void RiskChecker::release(const Order& order, uint32_t instrumentId, uint32_t accountId) {
+    if (instrumentId < positions_.size())
+        positions_[instrumentId] -= signedQuantity(order);
+    if (accountId < grossNotional_.size())
+        grossNotional_[accountId] -= order.price * order.quantity;
+}
+
+int64_t RiskChecker::position(uint32_t instrumentId) const {
+    return instrumentId < positions_.size() ? positions_[instrumentId] : 0;
+}
+
+double RiskChecker::grossNotional(uint32_t accountId) const {
+    return accountId < grossNotional_.size() ? grossNotional_[accountId] : 0.0;
+}
+
+uint64_t RiskChecker::checked() const {
+    return checked_;
+}
+
+uint64_t RiskChecker::rejected() const {
+    return rejected_;
+}
+
+uint64_t RiskChecker::rejectCount(RiskReject reason) const {
+    return rejectCounts_[static_cast<size_t>(reason)];
+}
@@ -0,0 +1,55 @@
+#include <RiskLimitStore.h>
+#include <stdexcept>
+
+namespace {
+
+const RiskLimits* validated(RiskLimits&& limits) {
+    if (limits.instruments.empty() || limits.accounts.empty())
+        throw std::invalid_argument("Risk limits need at least one instrument and one account");
+    return new RiskLimits(std::move(limits));
+}
+
+} // namespace
+
+RiskLimitStore::RiskLimitStore(RiskLimits initial) : current_(validated(std::move(initial))) {}
+
+RiskLimitStore::~RiskLimitStore() {
+    delete current_.load(std::memory_order_relaxed);
+}
+
+void RiskLimitStore::publish(RiskLimits next) {
+    // Built and validated before the swap; readers never wait on any of this
+    const RiskLimits* fresh = validated(std::move(next));
+    const RiskLimits* old = current_.exchange(fresh, std::memory_order_acq_rel);
+    epochs_.retire(const_cast<RiskLimits*>(old));
+    epochs_.reclaim();
+}
+
+size_t RiskLimitStore::reclaim() {
+    return epochs_.reclaim();
+}
+
+uint64_t RiskLimitStore::version() const {
+    return epochs_.epoch();
+}
+
+size_t RiskLimitStore::pendingReclaim() const {
+    return epochs_.pending();
+}
+
+size_t RiskLimitStore::registerReader() {
+    return epochs_.registerThread();
+}
+
+void RiskLimitStore::unregisterReader(size_t reader) {
+    epochs_.unregisterThread(reader);
+}
+
+// Plain load on x86; acquire only so the table contents are visible with the pointer
+const RiskLimits* RiskLimitStore::current() const {
+    return current_.load(std::memory_order_acquire);
+}
+
+void RiskLimitStore::quiescent(size_t reader) {
+    epochs_.quiescent(reader);
+}
@@ -0,0 +1,86 @@
+#include <Throttle.h>
+#include <WireOrder.h>
+#include <cstddef>
+#include <stdexcept>
+
+namespace {
+
+TokenBucket makeBucket(double rate, double burst, uint64_t ticksPerSecond) {
+    TokenBucket b;
+    b.capacity = static_cast<uint64_t>(burst * TokenBucket::TOKEN_ONE);
+    b.tokens = b.capacity;
+    b.refillPerTick = static_cast<uint64_t>(rate * TokenBucket::TOKEN_ONE / ticksPerSecond);
+    if (b.refillPerTick == 0) b.refillPerTick = 1;
+    return b;
+}
+
+void refill(TokenBucket& b, uint64_t nowTick) {
+    uint64_t elapsed = nowTick > b.lastTick ? nowTick - b.lastTick : 0;
+    b.lastTick = nowTick;
+    uint64_t missing = b.capacity - b.tokens;
+    // Compare in ticks first so long idle gaps cannot overflow the multiply
+    b.tokens = elapsed > missing / b.refillPerTick ? b.capacity : b.tokens + elapsed * b.refillPerTick;
+}
+
+// Tick at which `cost` tokens will be available again
+uint64_t readyAt(const TokenBucket& b, uint64_t cost, uint64_t nowTick) {
+    return nowTick + (cost - b.tokens + b.refillPerTick - 1) / b.refillPerTick;
+}
+
+} // namespace
+
+Throttle::Throttle(const ThrottleConfig& config, size_t sessions, size_t accounts) {
+    if (config.ticksPerSecond == 0)
+        throw std::invalid_argument("Throttle needs a non-zero tick frequency");
+    sessions_.assign(sessions, makeBucket(config.sessionRate, config.sessionBurst, config.ticksPerSecond));
+    accounts_.assign(accounts, makeBucket(config.accountRate, config.accountBurst, config.ticksPerSecond));
+    for (size_t i = 0; i < typeCost_.size(); ++i)
+        typeCost_[i] = uint64_t(config.typeCost[i]) * TokenBucket::TOKEN_ONE;
+}
+
+bool Throttle::admit(uint32_t sessionId, uint32_t accountId, OrderType type, uint64_t nowTick) {
+    size_t typeIndex = static_cast<size_t>(type);
+    if (sessionId >= sessions_.size() || accountId >= accounts_.size() || typeIndex >= typeCost_.size())
+        return false;
+
+    TokenBucket& s = sessions_[sessionId];
+    TokenBucket& a = accounts_[accountId];
+
+    // Reject fast path: a blocked bucket is not refilled until it can pay again
+    if (nowTick < s.blockedUntil || nowTick < a.blockedUntil) {
+        ++s.rejected;
+        return false;
+    }
+
+    uint64_t cost = typeCost_[typeIndex];
+    refill(s, nowTick);
+    refill(a, nowTick);
+
+    if (s.tokens >= cost && a.tokens >= cost) {
+        s.tokens -= cost;
+        a.tokens -= cost;
+        ++s.accepted;
+        return true;
+    }
+
+    if (s.tokens < cost) s.blockedUntil = readyAt(s, cost, nowTick);
+    if (a.tokens < cost) {
+        a.blockedUntil = readyAt(a, cost, nowTick);
+        ++a.rejected;
+    }
+    ++s.rejected;
+    return false;
+}
+
+bool Throttle::admitRaw(uint32_t sessionId, uint32_t accountId, const uint8_t* data, size_t size, uint64_t nowTick) {
+    if (size < sizeof(WireOrder)) return false;
+    return admit(sessionId, accountId, static_cast<OrderType>(data[offsetof(WireOrder, type)]), nowTick);
+}
+
+const TokenBucket& Throttle::session(uint32_t sessionId) const {
+    return sessions_.at(sessionId);
+}
+
+const TokenBucket& Throttle::account(uint32_t accountId) const {
+    return accounts_.at(accountId);
+}
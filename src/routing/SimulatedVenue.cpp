@@ -0,0 +1,72 @@
+#include <SimulatedVenue.h>
+#include <Clock.h>
+#include <stdexcept>
+
+SimulatedVenue::SimulatedVenue(SmartOrderRouter& router, const VenueConfig& config, size_t maxInstruments,
+                               size_t queueCapacity, uint64_t latencyTicks, uint64_t jitterTicks, uint64_t seed,
+                               FillSink sink)
+    : queue_(queueCapacity), router_(router), depth_(maxInstruments), book_(maxInstruments),
+      latencyTicks_(latencyTicks), jitterTicks_(jitterTicks), rng_(seed ? seed : 1), sink_(std::move(sink)),
+      id_(router.addVenue(config, &queue_)) {}
+
+void SimulatedVenue::setQuote(uint32_t instrumentId, const VenueQuote& quote) {
+    if (instrumentId >= book_.size()) return;
+    depth_[instrumentId] = quote;
+    book_[instrumentId] = quote;
+    router_.onQuote(id_, instrumentId, quote);
+}
+
+// xorshift64
+uint64_t SimulatedVenue::nextJitter() {
+    rng_ ^= rng_ << 13;
+    rng_ ^= rng_ >> 7;
+    rng_ ^= rng_ << 17;
+    return jitterTicks_ ? rng_ % (jitterTicks_ + 1) : 0;
+}
+
+size_t SimulatedVenue::poll(uint64_t nowTick) {
+    size_t processed = 0;
+    // Children are stamped in nanoseconds like every other Order
+    const uint64_t nowNs = static_cast<uint64_t>(ticksToNanos(nowTick));
+    Order child;
+    while (queue_.pop(child)) {
+        ++processed;
+        ++ordersReceived_;
+        if (child.instrument_id >= book_.size()) continue;
+
+        VenueQuote& q = book_[child.instrument_id];
+        const VenueQuote& full = depth_[child.instrument_id];
+        const bool buy = child.side == Side::Buy;
+        uint32_t& size = buy ? q.askSize : q.bidSize;
+        double price = buy ? q.askPrice : q.bidPrice;
+        bool crosses = buy ? child.price >= price : child.price <= price;
+
+        uint32_t filled = 0;
+        if (crosses && size > 0) {
+            filled = size < child.quantity ? size : child.quantity;
+            size -= filled;
+            if (size == 0) size = buy ? full.askSize : full.bidSize;
+        }
+        filledQty_ += filled;
+
+        uint64_t queued = nowNs > child.timestamp_ns ? nanosToTicks(nowNs - child.timestamp_ns) : 0;
+        router_.onAck(id_, queued + latencyTicks_ + nextJitter());
+        router_.onQuote(id_, child.instrument_id, q);
+        if (sink_)
+            sink_(VenueFill{child.order_id, child.instrument_id, id_, child.side, price, filled,
+                            child.quantity - filled});
+    }
+    return processed;
+}
+
+uint8_t SimulatedVenue::id() const {
+    return id_;
+}
+
+uint64_t SimulatedVenue::filledQty() const {
+    return filledQty_;
+}
+
+uint64_t SimulatedVenue::ordersReceived() const {
+    return ordersReceived_;
+}
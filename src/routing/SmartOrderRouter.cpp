@@ -0,0 +1,121 @@
+#include <SmartOrderRouter.h>
+#include <OrderIdGenerator.h>
+#include <Clock.h>
+#include <stdexcept>
+
+SmartOrderRouter::SmartOrderRouter(size_t maxInstruments, double latencyCostPerTick)
+    : quotes_(maxInstruments * MAX_VENUES), maxInstruments_(maxInstruments),
+      latencyCostPerTick_(latencyCostPerTick) {
+    if (maxInstruments == 0)
+        throw std::invalid_argument("SmartOrderRouter needs at least one instrument");
+}
+
+uint8_t SmartOrderRouter::addVenue(const VenueConfig& config, VenueQueue* queue) {
+    if (!queue) throw std::invalid_argument("Venue needs a sender queue");
+    if (venueCount_ == MAX_VENUES) throw std::length_error("Too many venues");
+    Venue& v = venues_[venueCount_];
+    v.queue = queue;
+    v.feePerShare = config.feePerShare;
+    v.latencyEwma = 0;
+    return static_cast<uint8_t>(venueCount_++);
+}
+
+void SmartOrderRouter::onQuote(uint8_t venue, uint32_t instrumentId, const VenueQuote& quote) {
+    if (venue >= venueCount_ || instrumentId >= maxInstruments_) return;
+    quotes_[size_t(instrumentId) * MAX_VENUES + venue] = quote;
+}
+
+void SmartOrderRouter::onAck(uint8_t venue, uint64_t latencyTicks) {
+    if (venue >= venueCount_) return;
+    Venue& v = venues_[venue];
+    uint64_t sample = latencyTicks << EWMA_SHIFT;
+    // First sample seeds the estimate
+    if (v.latencyEwma == 0) v.latencyEwma = sample;
+    else v.latencyEwma = v.latencyEwma - (v.latencyEwma >> EWMA_SHIFT) + latencyTicks;
+}
+
+bool SmartOrderRouter::send(uint8_t venue, const Order& parent, double price, uint32_t quantity, uint64_t nowNs) {
+    Order child(OrderIdGenerator::local().next(), nowNs, parent.symbol, price, quantity, parent.side, OrderType::Limit);
+    child.instrument_id = parent.instrument_id;
+    return venues_[venue].queue->push(child);
+}
+
+RouteResult SmartOrderRouter::route(const Order& order, uint64_t nowTick) {
+    RouteResult result;
+    if (order.instrument_id >= maxInstruments_ || venueCount_ == 0) {
+        result.unroutedQty = order.quantity;
+        return result;
+    }
+
+    VenueQuote* book = &quotes_[size_t(order.instrument_id) * MAX_VENUES];
+    const bool buy = order.side == Side::Buy;
+    const bool limited = order.type == OrderType::Limit;
+
+    // Rank venues by signed cost (buys pay it, sells receive its negation);
+    // insertion sort is cheapest at this size
+    double cost[MAX_VENUES];
+    uint8_t rank[MAX_VENUES];
+    size_t ranked = 0;
+    uint8_t cheapest = 0;
+    double cheapestCost = 0.0;
+    for (size_t v = 0; v < venueCount_; ++v) {
+        const Venue& venue = venues_[v];
+        double friction = venue.feePerShare
+            + double(venue.latencyEwma >> EWMA_SHIFT) * latencyCostPerTick_;
+        if (v == 0 || friction < cheapestCost) {
+            cheapest = static_cast<uint8_t>(v);
+            cheapestCost = friction;
+        }
+
+        const VenueQuote& q = book[v];
+        uint32_t size = buy ? q.askSize : q.bidSize;
+        double price = buy ? q.askPrice : q.bidPrice;
+        if (size == 0) continue;
+        if (limited && (buy ? price > order.price : price < order.price)) continue;
+
+        double c = buy ? price + friction : friction - price;
+        size_t i = ranked++;
+        while (i > 0 && cost[i - 1] > c) {
+            cost[i] = cost[i - 1];
+            rank[i] = rank[i - 1];
+            --i;
+        }
+        cost[i] = c;
+        rank[i] = static_cast<uint8_t>(v);
+    }
+
+    // Children are stamped in nanoseconds like every other Order; convert once per decision
+    const uint64_t nowNs = static_cast<uint64_t>(ticksToNanos(nowTick));
+    uint32_t remaining = order.quantity;
+    for (size_t i = 0; i < ranked && remaining > 0; ++i) {
+        VenueQuote& q = book[rank[i]];
+        uint32_t& size = buy ? q.askSize : q.bidSize;
+        uint32_t take = size < remaining ? size : remaining;
+        if (!send(rank[i], order, buy ? q.askPrice : q.bidPrice, take, nowNs)) continue;
+        size -= take;
+        remaining -= take;
+        result.routedQty += take;
+        ++result.children;
+    }
+
+    // Limit residual rests at the parent's price where it is cheapest to trade
+    if (remaining > 0 && limited && send(cheapest, order, order.price, remaining, nowNs)) {
+        result.restingQty = remaining;
+        ++result.children;
+        remaining = 0;
+    }
+    result.unroutedQty = remaining;
+    return result;
+}
+
+size_t SmartOrderRouter::venueCount() const {
+    return venueCount_;
+}
+
+const VenueQuote& SmartOrderRouter::quote(uint8_t venue, uint32_t instrumentId) const {
+    return quotes_[size_t(instrumentId) * MAX_VENUES + venue];
+}
+
+uint64_t SmartOrderRouter::latencyEstimate(uint8_t venue) const {
+    return venue < venueCount_ ? venues_[venue].latencyEwma >> EWMA_SHIFT : 0;
+}
@@ -0,0 +1,84 @@
+#include <PerfCounters.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+
+static int openEvent(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = groupFd < 0 ? 1 : 0;   // the leader gates the group
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+PerfCounters::PerfCounters() {
+    const uint64_t configs[EVENTS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES,
+    };
+    fds_[0] = openEvent(configs[0], -1);
+    if (fds_[0] < 0) return;
+    // Members a VM's PMU does not expose stay closed and read as zero
+    for (int i = 1; i < EVENTS; ++i) fds_[i] = openEvent(configs[i], fds_[0]);
+}
+
+PerfCounters::~PerfCounters() {
+    for (int fd : fds_)
+        if (fd >= 0) close(fd);
+}
+
+void PerfCounters::start() {
+    if (!available()) return;
+    ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void PerfCounters::pause() {
+    if (available()) ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void PerfCounters::resume() {
+    if (available()) ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfReading PerfCounters::stop() {
+    PerfReading reading;
+    if (!available()) return reading;
+    ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // PERF_FORMAT_GROUP: { nr, value[nr] } in the order members were opened
+    uint64_t buffer[1 + EVENTS] = {};
+    if (read(fds_[0], buffer, sizeof(buffer)) < static_cast<ssize_t>(sizeof(uint64_t))) return reading;
+
+    uint64_t values[EVENTS] = {};
+    uint64_t next = 1;
+    for (int i = 0; i < EVENTS && next <= buffer[0]; ++i)
+        if (fds_[i] >= 0) values[i] = buffer[next++];
+
+    reading.cycles = values[0];
+    reading.instructions = values[1];
+    reading.cacheMisses = values[2];
+    reading.branchMisses = values[3];
+    reading.valid = true;
+    return reading;
+}
+
+#else
+
+PerfCounters::PerfCounters() {}
+PerfCounters::~PerfCounters() {}
+void PerfCounters::start() {}
+void PerfCounters::pause() {}
+void PerfCounters::resume() {}
+PerfReading PerfCounters::stop() { return PerfReading{}; }
+
+#endif
@@ -0,0 +1,243 @@
+#include <PlatformCheck.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <filesystem>
+#endif
+
+static std::string trim(const std::string& s) {
+    size_t begin = s.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) return "";
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(begin, end - begin + 1);
+}
+
+static bool parseBool(const std::string& key, const std::string& value) {
+    if (value == "true" || value == "on" || value == "yes" || value == "1") return true;
+    if (value == "false" || value == "off" || value == "no" || value == "0") return false;
+    throw std::runtime_error("Tuning profile: " + key + " must be true or false, got " + value);
+}
+
+static uint32_t parseMicros(const std::string& key, const std::string& value) {
+    char* end = nullptr;
+    errno = 0;
+    unsigned long us = std::strtoul(value.c_str(), &end, 10);
+    if (value[0] < '0' || value[0] > '9' || *end != '\0' || errno == ERANGE || us > UINT32_MAX)
+        throw std::runtime_error("Tuning profile: " + key + " must be a number of microseconds or any, got " + value);
+    return static_cast<uint32_t>(us);
+}
+
+TuningProfile TuningProfile::load(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Cannot read tuning profile " + path);
+
+    TuningProfile profile;
+    std::string line;
+    while (std::getline(in, line)) {
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+        size_t eq = line.find('=');
+        if (eq == std::string::npos) throw std::runtime_error("Tuning profile: expected key = value, got " + line);
+        std::string key = trim(line.substr(0, eq));
+        std::string value = trim(line.substr(eq + 1));
+        if (value == "any") value.clear();
+
+        if (key == "governor") profile.governor = value;
+        else if (key == "turbo") {
+            if (!value.empty() && value != "on" && value != "off")
+                throw std::runtime_error("Tuning profile: turbo must be on, off or any");
+            profile.turbo = value;
+        }
+        else if (key == "isolated") profile.isolated = parseBool(key, value);
+        else if (key == "nohz_full") profile.nohzFull = parseBool(key, value);
+        else if (key == "thp") {
+            if (!value.empty() && value != "never" && value != "madvise" && value != "always")
+                throw std::runtime_error("Tuning profile: thp must be never, madvise, always or any");
+            profile.thp = value;
+        }
+        else if (key == "irq_free") profile.irqFree = parseBool(key, value);
+        else if (key == "max_cstate_latency_us") {
+            if (value.empty()) profile.maxCStateLatencyUs.reset();
+            else profile.maxCStateLatencyUs = parseMicros(key, value);
+        }
+        else throw std::runtime_error("Tuning profile: unknown key " + key);
+    }
+    return profile;
+}
+
+std::vector<unsigned> PlatformCheck::parseCpuList(const std::string& list) {
+    std::vector<unsigned> cpus;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t comma = list.find(',', pos);
+        std::string range = trim(list.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos));
+        pos = comma == std::string::npos ? list.size() : comma + 1;
+        if (range.empty() || range[0] < '0' || range[0] > '9') continue;   // also "(null)"
+
+        size_t dash = range.find('-');
+        unsigned first = static_cast<unsigned>(std::strtoul(range.c_str(), nullptr, 10));
+        unsigned last = dash == std::string::npos ? first
+                                                  : static_cast<unsigned>(std::strtoul(range.c_str() + dash + 1, nullptr, 10));
+        for (unsigned cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+std::string PlatformCheck::formatCpuList(const std::vector<unsigned>& cpus) {
+    std::string list;
+    for (size_t i = 0; i < cpus.size();) {
+        size_t j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) ++j;
+        if (!list.empty()) list += ',';
+        list += std::to_string(cpus[i]);
+        if (j > i) list += '-' + std::to_string(cpus[j]);
+        i = j + 1;
+    }
+    return list;
+}
+
+size_t PlatformCheck::report(const std::vector<PlatformFinding>& findings, std::ostream& out, bool all) {
+    size_t failures = 0;
+    for (size_t i = 0; i < findings.size();) {
+        const PlatformFinding& f = findings[i];
+        // Identical results on neighbouring cpus share one line
+        std::vector<unsigned> cpus;
+        size_t j = i;
+        for (; j < findings.size(); ++j) {
+            const PlatformFinding& g = findings[j];
+            if (g.check != f.check || g.status != f.status || g.expected != f.expected || g.actual != f.actual) break;
+            if (g.cpu >= 0) cpus.push_back(static_cast<unsigned>(g.cpu));
+        }
+        i = j;
+
+        failures += f.status == CheckStatus::Fail;
+        if (!all && f.status != CheckStatus::Fail) continue;
+        const char* tag = f.status == CheckStatus::Pass ? "[ ok ] " : f.status == CheckStatus::Fail ? "[FAIL] " : "[ ?? ] ";
+        out << tag << f.check;
+        if (!cpus.empty()) out << (cpus.size() > 1 ? " cpus " : " cpu ") << formatCpuList(cpus);
+        out << ": expected " << f.expected << ", found " << f.actual << "\n";
+    }
+    return failures;
+}
+
+#if defined(__linux__)
+
+static std::optional<std::string> readFirstLine(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) return std::nullopt;
+    std::string line;
+    std::getline(in, line);     // an empty file (no isolcpus) is a value too
+    return trim(line);
+}
+
+static bool contains(const std::vector<unsigned>& cpus, unsigned cpu) {
+    return std::binary_search(cpus.begin(), cpus.end(), cpu);
+}
+
+std::vector<PlatformFinding> PlatformCheck::run(const TuningProfile& profile, const std::vector<unsigned>& cpus) {
+    std::vector<PlatformFinding> findings;
+    const std::string sys = "/sys/devices/system/cpu/";
+    auto add = [&](std::string check, int cpu, std::string expected, std::optional<std::string> actual, bool pass) {
+        findings.push_back(PlatformFinding{std::move(check), cpu, std::move(expected), actual ? *actual : "nothing (not exposed)",
+                                           !actual ? CheckStatus::Unknown : pass ? CheckStatus::Pass : CheckStatus::Fail});
+    };
+
+    if (!profile.governor.empty()) {
+        for (unsigned cpu : cpus) {
+            auto governor = readFirstLine(sys + "cpu" + std::to_string(cpu) + "/cpufreq/scaling_governor");
+            add("governor", int(cpu), profile.governor, governor, governor == profile.governor);
+        }
+    }
+
+    if (!profile.turbo.empty()) {
+        std::optional<std::string> state;
+        if (auto noTurbo = readFirstLine(sys + "intel_pstate/no_turbo")) state = *noTurbo == "1" ? "off" : "on";
+        else if (auto boost = readFirstLine(sys + "cpufreq/boost")) state = *boost == "1" ? "on" : "off";
+        add("turbo", -1, profile.turbo, state, state == profile.turbo);
+    }
+
+    auto checkList = [&](const std::string& check, const std::string& file) {
+        auto list = readFirstLine(sys + file);
+        std::vector<unsigned> listed = list ? parseCpuList(*list) : std::vector<unsigned>{};
+        for (unsigned cpu : cpus) {
+            std::optional<std::string> actual;
+            if (list) actual = contains(listed, cpu) ? "listed" : "not listed (" + (list->empty() ? std::string("empty") : *list) + ")";
+            add(check, int(cpu), "listed", actual, list && contains(listed, cpu));
+        }
+    };
+    if (profile.isolated) checkList("isolcpus", "isolated");
+    if (profile.nohzFull) checkList("nohz_full", "nohz_full");
+
+    if (!profile.thp.empty()) {
+        // "always [madvise] never": the bracketed word is the active mode
+        std::optional<std::string> mode;
+        if (auto line = readFirstLine("/sys/kernel/mm/transparent_hugepage/enabled")) {
+            size_t open = line->find('['), close = line->find(']');
+            if (open != std::string::npos && close > open) mode = line->substr(open + 1, close - open - 1);
+        }
+        add("transparent hugepages", -1, profile.thp, mode, mode == profile.thp);
+    }
+
+    if (profile.irqFree) {
+        // Where each IRQ actually fires when the kernel says, else where it may
+        std::vector<std::vector<std::string>> irqsOn(cpus.size());
+        bool readable = false;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator("/proc/irq", ec)) {
+            std::string irq = entry.path().filename().string();
+            if (!entry.is_directory(ec) || irq.empty() || irq[0] < '0' || irq[0] > '9') continue;
+            auto list = readFirstLine(entry.path().string() + "/effective_affinity_list");
+            if (!list || list->empty()) list = readFirstLine(entry.path().string() + "/smp_affinity_list");
+            if (!list) continue;
+            readable = true;
+            std::vector<unsigned> targets = parseCpuList(*list);
+            for (size_t i = 0; i < cpus.size(); ++i)
+                if (contains(targets, cpus[i])) irqsOn[i].push_back(irq);
+        }
+        for (size_t i = 0; i < cpus.size(); ++i) {
+            std::optional<std::string> actual;
+            if (readable) {
+                actual = std::to_string(irqsOn[i].size()) + " IRQs";
+                for (size_t k = 0; k < irqsOn[i].size() && k < 5; ++k) *actual += (k ? ", " : " (") + irqsOn[i][k];
+                if (!irqsOn[i].empty()) *actual += irqsOn[i].size() > 5 ? ", ...)" : ")";
+            }
+            add("irq affinity", int(cpus[i]), "0 IRQs", actual, irqsOn[i].empty());
+        }
+    }
+
+    if (profile.maxCStateLatencyUs) {
+        const uint32_t limit = *profile.maxCStateLatencyUs;
+        for (unsigned cpu : cpus) {
+            std::string dir = sys + "cpu" + std::to_string(cpu) + "/cpuidle/";
+            std::optional<std::string> actual;
+            bool pass = true;
+            for (unsigned state = 0;; ++state) {
+                std::string prefix = dir + "state" + std::to_string(state) + "/";
+                auto latency = readFirstLine(prefix + "latency");
+                if (!latency) break;
+                if (!actual) actual = "no deeper state enabled";
+                if (readFirstLine(prefix + "disable") == "1" || std::strtoul(latency->c_str(), nullptr, 10) <= limit) continue;
+                if (pass) actual = "enabled:";
+                pass = false;
+                *actual += " " + readFirstLine(prefix + "name").value_or("state" + std::to_string(state)) + " (" + *latency + " us)";
+            }
+            add("c-states", int(cpu), "none deeper than " + std::to_string(limit) + " us", actual, pass);
+        }
+    }
+    return findings;
+}
+
+#else
+
+std::vector<PlatformFinding> PlatformCheck::run(const TuningProfile&, const std::vector<unsigned>&) {
+    return {PlatformFinding{"platform", -1, "Linux /sys and /proc", "another OS, nothing checked", CheckStatus::Unknown}};
+}
+
+#endif
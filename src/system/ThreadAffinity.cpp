@@ -0,0 +1,91 @@
+#include <ThreadAffinity.h>
+#include <algorithm>
+#include <thread>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <fstream>
+#include <string>
+#endif
+
+#if defined(_WIN32) || defined(_WIN64)
+
+bool ThreadAffinity::pinCurrentThread(unsigned cpu) {
+    if (cpu >= sizeof(DWORD_PTR) * 8) return false;
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+}
+
+std::vector<unsigned> ThreadAffinity::allowedCpus() {
+    std::vector<unsigned> cpus;
+    DWORD_PTR processMask = 0, systemMask = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) {
+        for (unsigned cpu = 0; cpu < sizeof(DWORD_PTR) * 8; ++cpu)
+            if (processMask & (DWORD_PTR(1) << cpu)) cpus.push_back(cpu);
+    }
+    if (cpus.empty()) cpus.push_back(0);
+    return cpus;
+}
+
+std::vector<CpuInfo> ThreadAffinity::topology() {
+    std::vector<CpuInfo> infos;
+    for (unsigned cpu : allowedCpus()) infos.push_back(CpuInfo{cpu, -1, -1});
+
+    DWORD bytes = 0;
+    GetLogicalProcessorInformation(nullptr, &bytes);
+    std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> entries(bytes / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+    if (entries.empty() || !GetLogicalProcessorInformation(entries.data(), &bytes)) return infos;
+
+    int core = 0, package = 0;
+    for (const auto& entry : entries) {
+        if (entry.Relationship != RelationProcessorCore && entry.Relationship != RelationProcessorPackage) continue;
+        int id = entry.Relationship == RelationProcessorCore ? core++ : package++;
+        for (CpuInfo& info : infos) {
+            if (info.cpu >= sizeof(ULONG_PTR) * 8 || !(entry.ProcessorMask & (ULONG_PTR(1) << info.cpu))) continue;
+            if (entry.Relationship == RelationProcessorCore) info.core = id;
+            else info.package = id;
+        }
+    }
+    return infos;
+}
+
+#else
+
+bool ThreadAffinity::pinCurrentThread(unsigned cpu) {
+    if (cpu >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+std::vector<unsigned> ThreadAffinity::allowedCpus() {
+    std::vector<unsigned> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (unsigned cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+    }
+    if (cpus.empty())
+        for (unsigned cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu) cpus.push_back(cpu);
+    return cpus;
+}
+
+std::vector<CpuInfo> ThreadAffinity::topology() {
+    std::vector<CpuInfo> infos;
+    for (unsigned cpu : allowedCpus()) {
+        CpuInfo info{cpu, -1, -1};
+        std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+        std::ifstream core(base + "core_id");
+        std::ifstream package(base + "physical_package_id");
+        if (core) core >> info.core;
+        if (package) package >> info.package;
+        infos.push_back(info);
+    }
+    return infos;
+}
+
+#endif
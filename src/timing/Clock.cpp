@@ -0,0 +1,58 @@
+#include <Clock.h>
+#include <chrono>
+#include <thread>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace {
+    uint64_t calibrateTsc() {
+        using namespace std::chrono;
+        auto t0 = steady_clock::now();
+        uint64_t c0 = __rdtsc();
+        std::this_thread::sleep_for(milliseconds(20));
+        auto t1 = steady_clock::now();
+        uint64_t c1 = __rdtsc();
+        double seconds = duration<double>(t1 - t0).count();
+        return static_cast<uint64_t>(double(c1 - c0) / seconds);
+    }
+}
+
+uint64_t TscClock::ticksPerSecond() {
+    static const uint64_t rate = calibrateTsc();
+    return rate;
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+
+uint64_t MonotonicClock::now() {
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return static_cast<uint64_t>(counter.QuadPart);
+}
+
+uint64_t MonotonicClock::ticksPerSecond() {
+    static const uint64_t rate = [] {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        return static_cast<uint64_t>(frequency.QuadPart);
+    }();
+    return rate;
+}
+
+#else
+
+uint64_t MonotonicClock::now() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uint64_t(ts.tv_sec) * 1'000'000'000 + uint64_t(ts.tv_nsec);
+}
+
+uint64_t MonotonicClock::ticksPerSecond() {
+    return 1'000'000'000;
+}
+
+#endif
@@ -0,0 +1,88 @@
+#include <TimerWheel.h>
+
+TimerWheel::TimerWheel(uint64_t startTick) : current_(startTick) {}
+
+void TimerWheel::link(TimerNode* node, Slot& slot) {
+    node->prev = nullptr;
+    node->next = slot.head;
+    if (slot.head) slot.head->prev = node;
+    slot.head = node;
+    node->linked = true;
+    ++levelCount_[node->level];
+    ++size_;
+}
+
+// Level is chosen by distance, slot by the expiry's own bits at that level,
+// so a slot cascades exactly when the level below wraps onto it
+void TimerWheel::place(TimerNode* node) {
+    uint64_t expiry = node->expiry < current_ ? current_ : node->expiry;
+    uint64_t delta = expiry - current_;
+    for (size_t level = 0; level < LEVELS; ++level) {
+        if (delta < (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+            node->level = static_cast<uint8_t>(level);
+            node->slot = static_cast<uint16_t>((expiry >> (SLOT_BITS * level)) & (SLOTS - 1));
+            link(node, levels_[level][node->slot]);
+            return;
+        }
+    }
+    node->level = LEVELS;
+    node->slot = 0;
+    link(node, overflow_);
+}
+
+TimerWheel::Slot& TimerWheel::slotOf(const TimerNode* node) {
+    return node->level == LEVELS ? overflow_ : levels_[node->level][node->slot];
+}
+
+void TimerWheel::schedule(TimerNode* node, uint64_t expiryTick) {
+    if (node->linked) cancel(node);
+    node->expiry = expiryTick;
+    place(node);
+}
+
+void TimerWheel::cancel(TimerNode* node) {
+    if (!node->linked) return;
+    if (node->prev) node->prev->next = node->next;
+    else slotOf(node).head = node->next;
+    if (node->next) node->next->prev = node->prev;
+    node->next = node->prev = nullptr;
+    node->linked = false;
+    --levelCount_[node->level];
+    --size_;
+}
+
+// Called when level 0 wraps: re-place each higher slot whose turn has come
+void TimerWheel::cascade() {
+    for (size_t level = 1; level <= LEVELS; ++level) {
+        Slot& slot = level == LEVELS
+            ? overflow_
+            : levels_[level][(current_ >> (SLOT_BITS * level)) & (SLOTS - 1)];
+        TimerNode* node = slot.head;
+        slot.head = nullptr;
+        while (node) {
+            TimerNode* next = node->next;
+            --levelCount_[node->level];
+            --size_;
+            place(node);
+            node = next;
+        }
+        if (level == LEVELS || ((current_ >> (SLOT_BITS * level)) & (SLOTS - 1)) != 0) break;
+    }
+}
+
+// First tick at which a cascade could bring work down to level 0
+uint64_t TimerWheel::nextBoundary() const {
+    size_t level = 1;
+    while (level < LEVELS && levelCount_[level] == 0) ++level;
+    if (level == LEVELS && levelCount_[LEVELS] == 0) return UINT64_MAX;
+    uint64_t span = uint64_t(1) << (SLOT_BITS * level);
+    return (current_ | (span - 1)) + 1;
+}
+
+size_t TimerWheel::size() const {
+    return size_;
+}
+
+uint64_t TimerWheel::currentTick() const {
+    return current_;
+}
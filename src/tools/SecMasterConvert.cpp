@@ -0,0 +1,25 @@
+#include <SecurityMaster.h>
+#include <iostream>
+
+// Converts a security master CSV into the binary file SecurityMaster maps:
+//   SecMasterConvert <input.csv> <output.bin>
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <input.csv> <output.bin>\n";
+        return 1;
+    }
+
+    auto instruments = SecurityMaster::readCsv(argv[1]);
+    if (!instruments) {
+        std::cerr << "Failed to read " << argv[1] << "\n";
+        return 1;
+    }
+
+    if (!SecurityMaster::writeFile(argv[2], *instruments)) {
+        std::cerr << "Failed to write " << argv[2] << " (duplicate symbols?)\n";
+        return 1;
+    }
+
+    std::cout << "Wrote " << instruments->size() << " instruments to " << argv[2] << "\n";
+    return 0;
+}
@@ -0,0 +1,162 @@
+#include "Check.h"
+#include <AlgoScheduler.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Child {
+    uint32_t quantity;
+    uint64_t tick;
+};
+
+ParentOrderSpec parent(AlgoType algo, uint32_t quantity, uint64_t start, uint64_t end, uint32_t slices) {
+    ParentOrderSpec spec;
+    spec.symbol[0] = 'X';
+    spec.algo = algo;
+    spec.quantity = quantity;
+    spec.limitPrice = 100.0;
+    spec.startTick = start;
+    spec.endTick = end;
+    spec.slices = slices;
+    return spec;
+}
+
+} // namespace
+
+static void rejectsBadSpecs() {
+    AlgoScheduler scheduler(8, 4, 10, 0, [](const Order&) {});
+    std::vector<double> negative{1.0, -0.5, 2.0};
+    std::vector<double> zero{0.0, 0.0, 0.0};
+    std::vector<double> nan{1.0, 0.0 / 0.0, 1.0};
+    std::vector<double> good{1.0, 0.0, 2.0};
+
+    ParentOrderSpec vwap = parent(AlgoType::VWAP, 100, 0, 100, 3);
+    CHECK(!scheduler.submit(vwap));                 // no profile
+    for (const std::vector<double>* profile : {&negative, &zero, &nan}) {
+        vwap.profile = profile;
+        CHECK(!scheduler.submit(vwap));
+    }
+    vwap.profile = &good;
+    vwap.slices = 2;
+    CHECK(!scheduler.submit(vwap));                 // profile length differs
+    vwap.slices = 3;
+    CHECK(scheduler.submit(vwap));
+
+    CHECK(!scheduler.submit(parent(AlgoType::TWAP, 0, 0, 100, 4)));
+    CHECK(!scheduler.submit(parent(AlgoType::TWAP, 100, 50, 10, 4)));
+    CHECK(!scheduler.submit(parent(AlgoType::TWAP, 100, 0, 100, 0)));
+    ParentOrderSpec pov = parent(AlgoType::POV, 100, 0, 100, 1);
+    CHECK(!scheduler.submit(pov));                  // no participation
+    pov.participation = 0.1;
+    pov.instrumentId = 4;
+    CHECK(!scheduler.submit(pov));                  // instrument out of range
+    CHECK(scheduler.activeCount() == 1);
+}
+
+static void slicesFollowTheSchedule() {
+    constexpr uint64_t START = 1'000'000;
+    std::vector<Child> children;
+    uint64_t now = START;
+    AlgoScheduler scheduler(8, 4, 10, START, [&](const Order& child) {
+        children.push_back(Child{child.quantity, now});
+    });
+
+    // TWAP: ten equal slices, one every 100 ticks
+    auto twap = scheduler.submit(parent(AlgoType::TWAP, 1000, START, START + 1000, 10));
+    CHECK(twap.has_value());
+    for (; scheduler.active(*twap); now += 10) scheduler.onTimer(now);
+    CHECK(children.size() == 10);
+    for (size_t i = 0; i < children.size(); ++i)
+        CHECK(children[i].quantity == 100 && children[i].tick == START + 100 * i);
+    CHECK(scheduler.sent(*twap) == 1000);
+
+    // VWAP: a zero-weight slice sends nothing, the last slice sends the rest
+    std::vector<double> profile{1.0, 3.0, 0.0, 6.0};
+    ParentOrderSpec spec = parent(AlgoType::VWAP, 1000, now, now + 400, 4);
+    spec.profile = &profile;
+    children.clear();
+    auto vwap = scheduler.submit(spec);
+    for (; scheduler.active(*vwap); now += 10) scheduler.onTimer(now);
+    CHECK(children.size() == 3);
+    CHECK(children.size() == 3 && children[0].quantity == 100 && children[1].quantity == 300
+          && children[2].quantity == 600);
+
+    // POV: no child below minClip; finishes once the quantity is done
+    spec = parent(AlgoType::POV, 50, now, now + 10'000, 1);
+    spec.participation = 0.1;
+    spec.minClip = 10;
+    spec.instrumentId = 2;
+    children.clear();
+    auto pov = scheduler.submit(spec);
+    scheduler.onMarketData(2, 50, now);
+    CHECK(children.empty());
+    scheduler.onMarketData(3, 1000, now);           // other instrument
+    scheduler.onMarketData(2, 60, now);
+    CHECK(children.size() == 1 && children[0].quantity == 11);
+    scheduler.onMarketData(2, 10'000, now);
+    CHECK(children.size() == 2 && scheduler.sent(*pov) == 50 && !scheduler.active(*pov));
+
+    // POV expiry ends the window with whatever was sent
+    spec.quantity = 1000;
+    pov = scheduler.submit(spec);
+    scheduler.onMarketData(2, 200, now);
+    now = spec.endTick;
+    scheduler.onTimer(now);
+    CHECK(!scheduler.active(*pov) && scheduler.sent(*pov) == 20);
+
+    auto cancelled = scheduler.submit(parent(AlgoType::TWAP, 100, now + 100, now + 200, 2));
+    scheduler.cancel(*cancelled);
+    size_t before = children.size();
+    scheduler.onTimer(now + 1000);
+    CHECK(children.size() == before && scheduler.activeCount() == 0);
+}
+
+// Ten thousand parents at once on one thread, on TSC-scale ticks: every
+// slice fires in the poll that reaches its slot and every parent completes
+static void thousandsOfParents() {
+    constexpr size_t PARENTS = 10000;
+    constexpr uint64_t SLOT = 1 << 16;                  // ~20 us at 3 GHz
+    constexpr uint64_t START = uint64_t(1) << 52;       // TSC after weeks of uptime
+    constexpr uint64_t WINDOW = 3'000'000'000;          // ~1 s
+    constexpr uint32_t SLICES = 20;
+
+    uint64_t now = START;
+    std::vector<ParentOrderSpec> specs(PARENTS);
+    std::vector<uint32_t> sent(PARENTS, 0), slices(PARENTS, 0);
+    size_t children = 0, offSlot = 0;
+    AlgoScheduler scheduler(PARENTS, 1, SLOT, START, [&](const Order& child) {
+        size_t i = static_cast<size_t>(child.price) - 1;    // limit price tags the parent
+        const ParentOrderSpec& s = specs[i];
+        uint64_t due = s.startTick + (s.endTick - s.startTick) * slices[i]++ / SLICES;
+        offSlot += now / SLOT != due / SLOT;
+        sent[i] += child.quantity;
+        ++children;
+    });
+
+    std::mt19937_64 rng(11);
+    for (size_t i = 0; i < PARENTS; ++i) {
+        uint64_t start = START + rng() % WINDOW;
+        specs[i] = parent(AlgoType::TWAP, 1000 + static_cast<uint32_t>(rng() % 9000), start, start + WINDOW, SLICES);
+        specs[i].limitPrice = double(i + 1);
+        CHECK(scheduler.submit(specs[i]).has_value());
+    }
+    CHECK(scheduler.activeCount() == PARENTS);
+
+    for (; scheduler.activeCount() > 0 && now < START + 3 * WINDOW; now += SLOT) scheduler.onTimer(now);
+
+    size_t incomplete = 0;
+    for (size_t i = 0; i < PARENTS; ++i) incomplete += sent[i] != specs[i].quantity;
+    CHECK(scheduler.activeCount() == 0);
+    CHECK(children == PARENTS * SLICES);
+    CHECK(offSlot == 0);
+    CHECK(incomplete == 0);
+}
+
+int main() {
+    rejectsBadSpecs();
+    slicesFollowTheSchedule();
+    thousandsOfParents();
+    return checkFailures();
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <cstdio>
+
+// Test assertion that stays on under NDEBUG: reports the failing condition
+// and lets the test carry on, so one run lists every broken expectation.
+// Each test's main returns checkFailures() for ctest.
+inline int& checkFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(cond)                                                            \
+    do {                                                                       \
+        if (!(cond)) {                                                         \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            ++checkFailures();                                                 \
+        }                                                                      \
+    } while (0)
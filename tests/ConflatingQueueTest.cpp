@@ -0,0 +1,86 @@
+#include "Check.h"
+#include <templates/conflating_queue/ConflatingQueue.h>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Both fields are written together, so a torn read shows up as a mismatch
+struct Quote {
+    uint64_t version;
+    uint64_t mirror;
+};
+
+} // namespace
+
+static void conflatesWhileUnread() {
+    conflatingqueue::ConflatingQueue<Quote> queue(4);
+    CHECK(queue.capacity() == 4);
+    CHECK(!queue.publish(4, Quote{1, 1}));
+
+    CHECK(queue.publish(2, Quote{1, 1}));
+    CHECK(queue.publish(0, Quote{1, 1}));
+    CHECK(queue.publish(2, Quote{2, 2}));
+    CHECK(queue.publish(2, Quote{3, 3}));
+    CHECK(queue.pending() == 2);
+    CHECK(queue.published() == 4);
+    CHECK(queue.conflated() == 2);
+
+    // Keys come out in first-dirtied order with their latest value
+    uint32_t key;
+    Quote value{};
+    CHECK(queue.pop(key, value) && key == 2 && value.version == 3);
+    CHECK(queue.pop(key, value) && key == 0 && value.version == 1);
+    CHECK(!queue.pop(key, value));
+
+    // A drained key is clean again and enqueues on its next update
+    CHECK(queue.publish(2, Quote{4, 4}));
+    CHECK(queue.pending() == 1);
+    CHECK(queue.pop(key, value) && key == 2 && value.version == 4);
+}
+
+// A producer far ahead of the consumer: values per key never go backwards,
+// are never torn, and the last one published is always delivered
+static void slowConsumerSeesLatest() {
+    constexpr uint32_t KEYS = 64;
+    constexpr uint64_t UPDATES = 2'000'000;
+    conflatingqueue::ConflatingQueue<Quote> queue(KEYS);
+    std::atomic<bool> done{false};
+
+    std::thread producer([&] {
+        for (uint64_t i = 1; i <= UPDATES; ++i) {
+            uint64_t version = (i + KEYS - 1) / KEYS;
+            queue.publish(static_cast<uint32_t>(i % KEYS), Quote{version, version});
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    std::vector<uint64_t> latest(KEYS, 0);
+    size_t torn = 0, backwards = 0;
+    auto drain = [&] {
+        uint32_t key;
+        Quote value;
+        while (queue.pop(key, value)) {
+            torn += value.version != value.mirror;
+            backwards += value.version < latest[key];
+            latest[key] = value.version;
+        }
+    };
+    while (!done.load(std::memory_order_acquire)) drain();
+    drain();
+    producer.join();
+
+    CHECK(torn == 0);
+    CHECK(backwards == 0);
+    for (uint32_t key = 0; key < KEYS; ++key) CHECK(latest[key] == UPDATES / KEYS);
+    CHECK(queue.published() == UPDATES);
+    CHECK(queue.pending() == 0);
+}
+
+int main() {
+    conflatesWhileUnread();
+    slowConsumerSeesLatest();
+    return checkFailures();
+}
@@ -0,0 +1,53 @@
+#include "Check.h"
+#include <Crc32c.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Bit-at-a-time reference, independent of the table and SSE4.2 paths
+static uint32_t reference(const uint8_t* data, size_t size) {
+    uint32_t crc = ~0u;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+int main() {
+    // Check value from the CRC catalogue and the iSCSI vectors (RFC 3720 B.4)
+    const char* digits = "123456789";
+    CHECK(Crc32c::compute(reinterpret_cast<const uint8_t*>(digits), 9) == 0xE3069283);
+    CHECK(Crc32c::computeShort(reinterpret_cast<const uint8_t*>(digits), 9) == 0xE3069283);
+
+    uint8_t block[32];
+    std::memset(block, 0x00, sizeof(block));
+    CHECK(Crc32c::compute(block, sizeof(block)) == 0x8A9136AA);
+    std::memset(block, 0xFF, sizeof(block));
+    CHECK(Crc32c::compute(block, sizeof(block)) == 0x62A8AB43);
+    for (size_t i = 0; i < sizeof(block); ++i) block[i] = static_cast<uint8_t>(i);
+    CHECK(Crc32c::compute(block, sizeof(block)) == 0x46DD794E);
+    for (size_t i = 0; i < sizeof(block); ++i) block[i] = static_cast<uint8_t>(31 - i);
+    CHECK(Crc32c::compute(block, sizeof(block)) == 0x113FDB5C);
+    CHECK(Crc32c::compute(block, 0) == 0);
+
+    // Every length around the interleaved block sizes, at odd alignments,
+    // and extended in two pieces
+    std::vector<uint8_t> buffer(4096 + 8);
+    uint32_t state = 12345;
+    for (uint8_t& b : buffer) b = static_cast<uint8_t>((state = state * 1103515245 + 12345) >> 16);
+
+    size_t mismatches = 0;
+    for (size_t offset = 0; offset < 4; ++offset) {
+        for (size_t size = 0; size <= 4096; size += size < 1100 ? 1 : 61) {
+            const uint8_t* data = buffer.data() + offset;
+            uint32_t expected = reference(data, size);
+            mismatches += Crc32c::compute(data, size) != expected;
+            mismatches += Crc32c::computeShort(data, size) != expected;
+            size_t split = size / 3;
+            mismatches += Crc32c::compute(data + split, size - split, Crc32c::compute(data, split)) != expected;
+        }
+    }
+    CHECK(mismatches == 0);
+    return checkFailures();
+}
@@ -0,0 +1,100 @@
+#include "Check.h"
+#include <DuplicateFilter.h>
+#include <LiveOrderIndex.h>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+// Random inserts and erases over a small key range, so probe runs collide
+// and backward-shift deletion is exercised, checked against unordered_set
+static void liveOrderIndexMatchesSet() {
+    constexpr size_t CAPACITY = 1000;
+    LiveOrderIndex index(CAPACITY);
+    std::unordered_set<uint64_t> reference;
+    std::mt19937_64 rng(7);
+
+    size_t mismatches = 0;
+    for (size_t op = 0; op < 200000; ++op) {
+        uint64_t key = rng() % 3000;
+        if (key == 0) key = UINT64_MAX;     // the table's empty marker is a valid id too
+        if (rng() % 2) {
+            bool expected = reference.size() < CAPACITY && !reference.count(key);
+            if (expected) reference.insert(key);
+            mismatches += index.insert(key) != expected;
+        } else {
+            mismatches += index.erase(key) != (reference.erase(key) == 1);
+        }
+        if (op % 1000 == 0)
+            for (uint64_t k = 1; k < 3000; ++k) mismatches += index.contains(k) != (reference.count(k) == 1);
+        mismatches += index.size() != reference.size();
+    }
+    CHECK(mismatches == 0);
+    CHECK(index.contains(UINT64_MAX) == (reference.count(UINT64_MAX) == 1));
+}
+
+static void liveOrderIndexCapacity() {
+    LiveOrderIndex index(3);
+    CHECK(index.capacity() == 3);
+    CHECK(index.insert(1) && index.insert(2) && index.insert(UINT64_MAX));
+    CHECK(!index.insert(4));        // full
+    CHECK(!index.insert(1));        // already present
+    CHECK(index.erase(UINT64_MAX) && !index.erase(UINT64_MAX));
+    CHECK(index.insert(4));
+    CHECK(index.size() == 3);
+}
+
+static void bloomFilterHasNoFalseNegatives() {
+    constexpr size_t KEYS = 100000;
+    BlockedBloomFilter bloom(KEYS);
+    size_t firstTimePositives = 0;
+    for (uint64_t id = 1; id <= KEYS; ++id) firstTimePositives += bloom.testAndAdd(LiveOrderIndex::hash(id));
+
+    size_t negatives = 0;
+    for (uint64_t id = 1; id <= KEYS; ++id) negatives += !bloom.mayContain(LiveOrderIndex::hash(id));
+    CHECK(negatives == 0);
+
+    // 16 bits per key with k = 8 should stay well under 1%
+    size_t falsePositives = 0;
+    for (uint64_t id = KEYS + 1; id <= 2 * KEYS; ++id) falsePositives += bloom.mayContain(LiveOrderIndex::hash(id));
+    CHECK(falsePositives < KEYS / 100);
+    CHECK(firstTimePositives < KEYS / 100);
+
+    bloom.clear();
+    CHECK(!bloom.mayContain(LiveOrderIndex::hash(1)));
+}
+
+static void detectorFlagsLiveReplaysOnly() {
+    constexpr size_t IDS = 50000;
+    DuplicateDetector detector(IDS, IDS);
+    size_t flagged = 0;
+    for (uint64_t id = 1; id <= IDS; ++id) flagged += detector.isDuplicate(id * 2654435761ULL);
+    CHECK(flagged == 0);
+
+    // Replays of live ids are duplicates; once closed an id may be sent again
+    for (uint64_t id = 1; id <= 100; ++id) CHECK(detector.isDuplicate(id * 2654435761ULL));
+    for (uint64_t id = 1; id <= 100; ++id) detector.onOrderClosed(id * 2654435761ULL);
+    for (uint64_t id = 1; id <= 100; ++id) CHECK(!detector.isDuplicate(id * 2654435761ULL));
+    CHECK(detector.isDuplicate(2654435761ULL));
+
+    CHECK(detector.duplicates() == 101);
+    CHECK(detector.bloomPositives() >= 201);
+    CHECK(detector.untracked() == 0);
+}
+
+static void detectorCountsUntracked() {
+    DuplicateDetector detector(100, 2);
+    CHECK(!detector.isDuplicate(1) && !detector.isDuplicate(2));
+    CHECK(!detector.isDuplicate(3));    // live index full: passed but not tracked
+    CHECK(detector.untracked() == 1);
+    CHECK(!detector.isDuplicate(3));
+}
+
+int main() {
+    liveOrderIndexMatchesSet();
+    liveOrderIndexCapacity();
+    bloomFilterHasNoFalseNegatives();
+    detectorFlagsLiveReplaysOnly();
+    detectorCountsUntracked();
+    return checkFailures();
+}
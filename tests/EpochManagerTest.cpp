@@ -0,0 +1,86 @@
+#include "Check.h"
+#include <templates/epoch/EpochManager.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t MAGIC = 0x5AFE5AFE5AFE5AFEULL;
+
+std::atomic<int> liveTables{0};
+
+struct Table {
+    uint64_t check = MAGIC;
+    uint64_t version;
+    explicit Table(uint64_t v) : version(v) { liveTables.fetch_add(1, std::memory_order_relaxed); }
+    ~Table() {
+        check = 0;
+        liveTables.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+} // namespace
+
+// Readers come and go in rounds while a writer keeps replacing the table:
+// far more registrations than slots must succeed, freed slots must be
+// reused, and no reader may ever see a freed table
+int main() {
+    constexpr size_t ROUNDS = 500;
+    constexpr size_t READERS = 4;
+    constexpr size_t BATCHES = 50;
+
+    epoch::EpochManager<16> epochs;
+    std::atomic<Table*> current{new Table(0)};
+    std::atomic<bool> writing{true};
+    std::atomic<size_t> highestSlot{0};
+    std::atomic<size_t> badReads{0};
+
+    std::thread writer([&] {
+        uint64_t version = 1;
+        while (writing.load(std::memory_order_relaxed)) {
+            Table* old = current.exchange(new Table(version++), std::memory_order_acq_rel);
+            epochs.retire(old);
+            std::this_thread::yield();
+        }
+    });
+    epochs.startReclaimer(std::chrono::microseconds(50));
+
+    size_t registrations = 0;
+    for (size_t round = 0; round < ROUNDS; ++round) {
+        std::vector<std::thread> readers;
+        for (size_t r = 0; r < READERS; ++r) {
+            readers.emplace_back([&, r] {
+                size_t tid = epochs.registerThread();
+                size_t seen = highestSlot.load(std::memory_order_relaxed);
+                while (tid > seen && !highestSlot.compare_exchange_weak(seen, tid)) {}
+
+                const bool bracketed = r % 2 == 1;
+                for (size_t b = 0; b < BATCHES; ++b) {
+                    if (bracketed) epochs.enter(tid);
+                    Table* t = current.load(std::memory_order_acquire);
+                    if (t->check != MAGIC) badReads.fetch_add(1, std::memory_order_relaxed);
+                    if (bracketed) epochs.exit(tid);
+                    else epochs.quiescent(tid);
+                }
+                epochs.unregisterThread(tid);
+            });
+        }
+        for (std::thread& t : readers) t.join();
+        registrations += READERS;
+    }
+
+    writing.store(false, std::memory_order_relaxed);
+    writer.join();
+    epochs.stopReclaimer();
+    epochs.reclaim();
+
+    CHECK(registrations == ROUNDS * READERS);
+    CHECK(highestSlot.load() < READERS);
+    CHECK(badReads.load() == 0);
+    CHECK(epochs.pending() == 0);
+    CHECK(liveTables.load() == 1);
+
+    delete current.load();
+    return checkFailures();
+}
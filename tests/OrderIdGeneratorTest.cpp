@@ -0,0 +1,103 @@
+#include "Check.h"
+#include <OrderIdGenerator.h>
+#include <Clock.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+static uint64_t wallMs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+// A used-up millisecond borrows the next one and a clock that steps back is
+// ignored, so ids from one shard only ever increase
+static void fieldsAndBorrowing() {
+    constexpr uint64_t BASE = OrderIdGenerator::ID_EPOCH_MS + 1000;
+    constexpr uint32_t PER_MS = 1u << OrderIdGenerator::SEQUENCE_BITS;
+    OrderIdGenerator generator(5);
+    CHECK(generator.shard() == 5);
+
+    uint64_t previous = 0;
+    size_t decreasing = 0, wrongShard = 0;
+    for (uint32_t i = 0; i < PER_MS + 10; ++i) {
+        uint64_t id = generator.next(BASE);
+        decreasing += id <= previous;
+        wrongShard += OrderIdGenerator::shardOf(id) != 5;
+        if (i == 0) CHECK(OrderIdGenerator::timestampMs(id) == BASE && OrderIdGenerator::sequenceOf(id) == 0);
+        if (i == PER_MS - 1) CHECK(OrderIdGenerator::timestampMs(id) == BASE && OrderIdGenerator::sequenceOf(id) == PER_MS - 1);
+        if (i == PER_MS) CHECK(OrderIdGenerator::timestampMs(id) == BASE + 1 && OrderIdGenerator::sequenceOf(id) == 0);
+        previous = id;
+    }
+    uint64_t stepBack = generator.next(BASE - 500);
+    decreasing += stepBack <= previous;
+    uint64_t later = generator.next(BASE + 60'000);
+    decreasing += later <= stepBack;
+    CHECK(OrderIdGenerator::timestampMs(later) == BASE + 60'000 && OrderIdGenerator::sequenceOf(later) == 0);
+    CHECK(decreasing == 0);
+    CHECK(wrongShard == 0);
+}
+
+// Threads in rounds take ids from local(): no id repeats across threads or
+// across the threads that inherit an exited thread's shard
+static void uniqueAcrossThreads() {
+    constexpr size_t ROUNDS = 3;
+    constexpr size_t THREADS = 8;
+    constexpr size_t IDS = 100000;
+
+    std::vector<std::vector<uint64_t>> ids(ROUNDS * THREADS, std::vector<uint64_t>(IDS));
+    uint64_t startMs = wallMs();
+    for (size_t round = 0; round < ROUNDS; ++round) {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < THREADS; ++t) {
+            threads.emplace_back([&ids, slot = round * THREADS + t] {
+                OrderIdGenerator& generator = OrderIdGenerator::local();
+                for (uint64_t& id : ids[slot]) id = generator.next();
+            });
+        }
+        for (std::thread& t : threads) t.join();
+    }
+    uint64_t endMs = wallMs();
+
+    std::vector<uint64_t> all;
+    size_t decreasing = 0, outOfRange = 0;
+    for (const std::vector<uint64_t>& thread : ids) {
+        for (size_t i = 0; i < thread.size(); ++i) {
+            if (i > 0) decreasing += thread[i] <= thread[i - 1];
+            // Borrowing can run a busy shard a few ms ahead of the wall clock;
+            // under SimClock ids follow simulated time instead
+            uint64_t ms = OrderIdGenerator::timestampMs(thread[i]);
+            if (!EngineClock::simulated) outOfRange += ms + 1 < startMs || ms > endMs + 1000;
+        }
+        all.insert(all.end(), thread.begin(), thread.end());
+    }
+    std::sort(all.begin(), all.end());
+    CHECK(decreasing == 0);
+    CHECK(outOfRange == 0);
+    CHECK(std::adjacent_find(all.begin(), all.end()) == all.end());
+}
+
+// Shards are returned on thread exit, so more than MAX_SHARDS threads may
+// use ids over the process lifetime
+static void shardsAreRecycled() {
+    size_t failures = 0;
+    for (size_t i = 0; i < OrderIdGenerator::MAX_SHARDS + 44; ++i) {
+        std::thread([&failures] {
+            try {
+                OrderIdGenerator::local().next();
+            } catch (...) {
+                ++failures;
+            }
+        }).join();
+    }
+    CHECK(failures == 0);
+}
+
+int main() {
+    fieldsAndBorrowing();
+    uniqueAcrossThreads();
+    shardsAreRecycled();
+    return checkFailures();
+}
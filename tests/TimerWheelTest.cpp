@@ -0,0 +1,82 @@
+#include "Check.h"
+#include <TimerWheel.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Timers spread over every level and the overflow list, some already due,
+// some cancelled, polled in uneven steps from a non-zero start tick: each
+// live timer fires exactly once, in the first poll that reaches its expiry
+int main() {
+    constexpr uint64_t START = 1'000'000'007;
+    constexpr size_t TIMERS = 20000;
+    constexpr uint64_t PERIOD = 1000;
+
+    TimerWheel wheel(START);
+    CHECK(wheel.currentTick() == START);
+
+    std::mt19937_64 rng(42);
+    const uint64_t spans[] = {300, 70'000, uint64_t(1) << 24, uint64_t(1) << 33};
+    std::vector<TimerNode> nodes(TIMERS);
+    std::vector<uint32_t> fired(TIMERS, 0);
+    std::vector<bool> cancelled(TIMERS, false);
+    uint64_t last = START;
+    for (size_t i = 0; i < TIMERS; ++i) {
+        uint64_t span = spans[i % 4];
+        uint64_t expiry = i % 50 == 0 ? START - 1 - rng() % 1000 : START + rng() % span;
+        nodes[i].cookie = i;
+        wheel.schedule(&nodes[i], expiry);
+        last = expiry > last ? expiry : last;
+    }
+    // Rescheduling a linked node moves it
+    wheel.schedule(&nodes[1], START + 5);
+    CHECK(wheel.size() == TIMERS);
+    for (size_t i = 3; i < TIMERS; i += 7) {
+        wheel.cancel(&nodes[i]);
+        cancelled[i] = true;
+    }
+    wheel.cancel(&nodes[3]);    // cancelling twice is a no-op
+
+    // Reschedules itself from the callback one period after its last expiry
+    TimerNode periodic;
+    periodic.cookie = TIMERS;
+    const uint64_t firstPeriodic = START + 10;
+    wheel.schedule(&periodic, firstPeriodic);
+    uint64_t periodicFires = 0;
+
+    const uint64_t steps[] = {1, 17, 1000, uint64_t(1) << 20};
+    uint64_t previous = START - 1;
+    uint64_t now = START;
+    size_t early = 0, late = 0;
+    while (previous < last) {
+        wheel.poll(now, [&](TimerNode* node) {
+            if (node->cookie == TIMERS) {
+                ++periodicFires;
+                wheel.schedule(node, node->expiry + PERIOD);
+                return;
+            }
+            ++fired[node->cookie];
+            if (node->expiry > now) ++early;
+            if (node->expiry > previous && node->expiry <= now) return;
+            if (node->expiry >= START) ++late;   // past expiries fire on the first poll
+        });
+        previous = now;
+        now += steps[rng() % 4];
+    }
+
+    size_t missed = 0, twice = 0, cancelledFired = 0;
+    for (size_t i = 0; i < TIMERS; ++i) {
+        if (cancelled[i]) cancelledFired += fired[i] != 0;
+        else if (fired[i] == 0) ++missed;
+        else if (fired[i] > 1) ++twice;
+    }
+    CHECK(early == 0);
+    CHECK(late == 0);
+    CHECK(missed == 0);
+    CHECK(twice == 0);
+    CHECK(cancelledFired == 0);
+    CHECK(periodicFires == (previous - firstPeriodic) / PERIOD + 1);
+    CHECK(wheel.size() == 1);
+    CHECK(wheel.currentTick() == previous + 1);
+    return checkFailures();
+}